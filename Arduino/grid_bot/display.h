@@ -0,0 +1,16 @@
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+// Compile-time display selection. UI code draws through Display, which is
+// the ILI9341 driver on the robot and an in-memory RGB565 framebuffer when
+// built for a host with GRID_BOT_HOST defined. The choice is a typedef, so
+// there is no extra indirection on the MCU.
+#ifdef GRID_BOT_HOST
+#include "host_framebuffer.h"
+typedef HostFramebuffer Display;
+#else
+#include <Adafruit_ILI9341.h>
+typedef Adafruit_ILI9341 Display;
+#endif
+
+#endif
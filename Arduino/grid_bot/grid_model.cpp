@@ -1,31 +1,19 @@
 #include "grid_model.h"
-#include <Adafruit_GFX.h>
 
 GridModel::GridModel() {
   // Initialize member variables
   numRows = 0;
   numCols = 0;
   
-  // Initialize grid data
-  gridVals = nullptr;
-  
   // Initialize path data
-  path = nullptr;
-  pathLength = 0;
   currentPathIndex = 0;
   currentDirection = UP;
 }
 
 void GridModel::initGrid(int numRows_, int numCols_) {
-  // Set grid size based on parameters
-  numRows = numRows_;
-  numCols = numCols_;
-
-  // Initialize 2D grid of cell values
-  gridVals = new bool*[numRows];
-  for (int i = 0; i < numRows; i++) {
-    gridVals[i] = new bool[numCols];
-  }
+  // Set grid size based on parameters, limited to the static capacity
+  numRows = min(numRows_, GRID_MAX_ROWS);
+  numCols = min(numCols_, GRID_MAX_COLS);
 
   // Reset all grid values to false
   resetGridValues();
@@ -35,24 +23,30 @@ void GridModel::initGrid(int numRows_, int numCols_) {
 }
 
 void GridModel::resetGridValues() {
-  for (int i = 0; i < numRows; i++) {
-    for (int j = 0; j < numCols; j++) {
-      gridVals[i][j] = false;
-    }
-  }
+  memset(gridBits, 0, sizeof(gridBits));
+  markAllDirty();
 }
 
 void GridModel::initPath() {
-  // Initialize array of path points
-  path = new PathCell[numRows * numCols];
+  // Start from an empty path
+  path.clear();
+
+  // Initialize per-cell path positions, all bytes 0xFF marks cells not on the path
+  memset(pathIndex, 0xFF, sizeof(pathIndex));
   
   // Set initial default path points
   resetDefaultPath();
 }
 
 void GridModel::resetDefaultPath() {
+  // Clear per-cell positions of the previous path
+  for (PackedPath::Iterator it = path.begin(); it != path.end(); ++it) {
+    pathIndex[cellOffset((*it).row, (*it).col)] = -1;
+  }
+  markAllDirty();
+
   // Set path length to zero
-  pathLength = 0;
+  path.clear();
   currentPathIndex = 0;
 
   // Add two points at center bottom of grid
@@ -64,21 +58,87 @@ void GridModel::resetDefaultPath() {
 
 void GridModel::pathAdd(int row, int col) {
   // Add coordinate to the list of path points
-  path[pathLength] = { row, col };
-  pathLength += 1;
+  PathCell last = path.last();
+  int previousRow = last.row;
+  int previousCol = last.col;
+  if (!path.push(row, col)) {
+    return;
+  }
+  pathIndex[cellOffset(row, col)] = (PathPos)(path.length() - 1);
+
+  // Previous last cell changes arrow, neighbours of both ends change selectability
+  if (path.length() > 1) {
+    markCellAndNeighborsDirty(previousRow, previousCol);
+  }
+  markCellAndNeighborsDirty(row, col);
 
   // Update the grid value of point
-  gridVals[row][col] = true;
+  writeBit(gridBits, cellOffset(row, col), true);
+}
+
+void GridModel::setPath(const PackedPath &newPath) {
+  // Clear cells of the current path
+  for (PackedPath::Iterator it = path.begin(); it != path.end(); ++it) {
+    writeBit(gridBits, cellOffset((*it).row, (*it).col), false);
+    pathIndex[cellOffset((*it).row, (*it).col)] = -1;
+  }
+  path.clear();
+  currentPathIndex = 0;
+  markAllDirty();
+
+  // Add cells of the new path
+  for (PackedPath::Iterator it = newPath.begin(); it != newPath.end(); ++it) {
+    pathAdd((*it).row, (*it).col);
+  }
+}
+
+bool GridModel::pathPop() {
+  // Keep the default path in place
+  if (path.length() <= DEFAULT_PATH_LENGTH) {
+    return false;
+  }
+
+  // Release the last cell and drop it from the path
+  PathCell last = path.last();
+  writeBit(gridBits, cellOffset(last.row, last.col), false);
+  pathIndex[cellOffset(last.row, last.col)] = -1;
+  path.pop();
+
+  // Removed cell, new last cell and their neighbours change appearance
+  markCellAndNeighborsDirty(last.row, last.col);
+  PathCell newLast = path.last();
+  markCellAndNeighborsDirty(newLast.row, newLast.col);
+  return true;
+}
+
+bool GridModel::pathRedo() {
+  // Popped cells stay free until a different step is added, so replay is safe
+  PathCell previous = path.last();
+  if (!path.redo()) {
+    return false;
+  }
+  PathCell last = path.last();
+  writeBit(gridBits, cellOffset(last.row, last.col), true);
+  pathIndex[cellOffset(last.row, last.col)] = (PathPos)(path.length() - 1);
+
+  // Previous and new last cells and their neighbours change appearance
+  markCellAndNeighborsDirty(previous.row, previous.col);
+  markCellAndNeighborsDirty(last.row, last.col);
+  return true;
+}
+
+int GridModel::getRedoLength() {
+  return path.redoLength();
 }
 
 bool GridModel::isSelectable(int row, int col) {
-  // If cell is already selected, it's not selectable
-  if (gridVals[row][col]) {
+  // If cell is outside the grid or already selected, it's not selectable
+  if (!isInGridBounds(row, col) || testBit(gridBits, cellOffset(row, col))) {
     return false;
   }
 
   // Get the last point in the path
-  PathCell lastPoint = path[pathLength - 1];
+  PathCell lastPoint = path.last();
 
   // Check if cell is adjacent (not diagonal) to last point
   bool isAdjacent = (
@@ -97,14 +157,15 @@ void GridModel::resetPath() {
 
 bool GridModel::getGridValue(int row, int col) {
   if (isInGridBounds(row, col)) {
-    return gridVals[row][col];
+    return testBit(gridBits, cellOffset(row, col));
   }
   return false;
 }
 
 void GridModel::setGridValue(int row, int col, bool value) {
   if (isInGridBounds(row, col)) {
-    gridVals[row][col] = value;
+    writeBit(gridBits, cellOffset(row, col), value);
+    markCellAndNeighborsDirty(row, col);
   }
 }
 
@@ -112,19 +173,39 @@ bool GridModel::isCellActivated(int row, int col) {
   return getGridValue(row, col);
 }
 
-PathCell GridModel::getPathCell(int index) {
-  if (index >= 0 && index < pathLength) {
-    return path[index];
+int GridModel::countSetCells() {
+  // Count a word at a time, padding bits past the last cell are never set
+  int count = 0;
+  for (long i = 0; i < GRID_WORDS; i++) {
+    count += __builtin_popcountl(gridBits[i]);
+  }
+  return count;
+}
+
+PathCell GridModel::findFreeNeighbor(int row, int col) {
+  // Check neighbours in Direction order: up, right, down, left
+  const int rowSteps[] = { -1, 0, 1, 0 };
+  const int colSteps[] = { 0, 1, 0, -1 };
+  for (int i = 0; i < 4; i++) {
+    int nextRow = row + rowSteps[i];
+    int nextCol = col + colSteps[i];
+    if (isInGridBounds(nextRow, nextCol) && !testBit(gridBits, cellOffset(nextRow, nextCol))) {
+      return { (GridCoord)nextRow, (GridCoord)nextCol };
+    }
   }
-  return { -1, -1 }; // Invalid cell
+  return { -1, -1 }; // No free neighbour
+}
+
+PathCell GridModel::getPathCell(int index) {
+  return path.cellAt(index);
 }
 
-PathCell* GridModel::getPath() {
+const PackedPath& GridModel::getPath() {
   return path;
 }
 
 int GridModel::getPathLength() {
-  return pathLength;
+  return path.length();
 }
 
 int GridModel::getCurrentPathIndex() {
@@ -132,7 +213,9 @@ int GridModel::getCurrentPathIndex() {
 }
 
 void GridModel::setCurrentPathIndex(int index) {
-  if (index >= 0 && index < pathLength) {
+  if (index >= 0 && index < path.length()) {
+    // Cells between the old and new index change processed state
+    markPathDirty(min(index, currentPathIndex), max(index, currentPathIndex));
     currentPathIndex = index;
   }
 }
@@ -146,7 +229,88 @@ PathCell GridModel::getNextPathCell() {
 }
 
 bool GridModel::isPathComplete() {
-  return currentPathIndex >= pathLength - 1;
+  return currentPathIndex >= path.length() - 1;
+}
+
+void GridModel::markCellDirty(int row, int col) {
+  if (isInGridBounds(row, col)) {
+    writeBit(dirtyBits, cellOffset(row, col), true);
+  }
+}
+
+void GridModel::clearCellDirty(int row, int col) {
+  if (isInGridBounds(row, col)) {
+    writeBit(dirtyBits, cellOffset(row, col), false);
+  }
+}
+
+void GridModel::markCellAndNeighborsDirty(int row, int col) {
+  markCellDirty(row, col);
+  markCellDirty(row - 1, col);
+  markCellDirty(row, col + 1);
+  markCellDirty(row + 1, col);
+  markCellDirty(row, col - 1);
+}
+
+void GridModel::markPathDirty(int fromIndex, int toIndex) {
+  // Sequential cellAt calls walk one step each
+  for (int i = max(fromIndex, 0); i <= toIndex && i < path.length(); i++) {
+    PathCell cell = path.cellAt(i);
+    markCellDirty(cell.row, cell.col);
+  }
+}
+
+void GridModel::markAllDirty() {
+  // Only the bits of real cells are set, so hasDirtyCells() turns false once
+  // every cell has been cleared
+  long cells = (long)numRows * numCols;
+  long fullWords = cells / GRID_WORD_BITS;
+  int lastBits = cells % GRID_WORD_BITS;
+  long usedWords = fullWords;
+  memset(dirtyBits, 0xFF, fullWords * sizeof(GridWord));
+  if (lastBits > 0) {
+    dirtyBits[usedWords++] = ((GridWord)1 << lastBits) - 1;
+  }
+  memset(dirtyBits + usedWords, 0, (GRID_WORDS - usedWords) * sizeof(GridWord));
+}
+
+bool GridModel::isCellDirty(int row, int col) {
+  if (isInGridBounds(row, col)) {
+    return testBit(dirtyBits, cellOffset(row, col));
+  }
+  return false;
+}
+
+bool GridModel::hasDirtyCells() {
+  // Words past the last cell are never set
+  long words = ((long)numRows * numCols + GRID_WORD_BITS - 1) / GRID_WORD_BITS;
+  for (long i = 0; i < words; i++) {
+    if (dirtyBits[i] != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void GridModel::clearDirty() {
+  memset(dirtyBits, 0, sizeof(dirtyBits));
+}
+
+int GridModel::pathIndexAt(int row, int col) {
+  if (isInGridBounds(row, col)) {
+    return pathIndex[cellOffset(row, col)];
+  }
+  return -1; // Not on path
+}
+
+PathCell GridModel::nextCellOf(int row, int col) {
+  // Cell following this one on the path, or invalid if it is the last cell
+  int index = pathIndexAt(row, col);
+  if (index >= 0 && index < path.length() - 1) {
+    PathCell cell = { (GridCoord)row, (GridCoord)col };
+    return stepCell(cell, path.stepDirection(index));
+  }
+  return { -1, -1 }; // Not on path or last cell
 }
 
 Direction GridModel::getCurrentDirection() {
@@ -165,8 +329,26 @@ int GridModel::getNumCols() {
   return numCols;
 }
 
+int GridModel::cellOffset(int row, int col) {
+  return row * numCols + col;
+}
+
+bool GridModel::testBit(const GridWord* bits, int offset) {
+  return (bits[offset / GRID_WORD_BITS] >> (offset % GRID_WORD_BITS)) & 1;
+}
+
+void GridModel::writeBit(GridWord* bits, int offset, bool value) {
+  GridWord mask = (GridWord)1 << (offset % GRID_WORD_BITS);
+  if (value) {
+    bits[offset / GRID_WORD_BITS] |= mask;
+  } else {
+    bits[offset / GRID_WORD_BITS] &= ~mask;
+  }
+}
+
 bool GridModel::isInGridBounds(int row, int col) {
-  return row >= 0 && row < numRows && col >= 0 && col < numCols;
+  // Unsigned compares fold the negative checks into the upper bounds
+  return (unsigned)row < (unsigned)numRows && (unsigned)col < (unsigned)numCols;
 }
 
 void GridModel::clearAll() {
@@ -174,20 +356,28 @@ void GridModel::clearAll() {
   resetDefaultPath();
 }
 
+void GridModel::printMemoryReport(Print &out) {
+  out.print("GridModel capacity ");
+  out.print(GRID_MAX_ROWS);
+  out.print("x");
+  out.print(GRID_MAX_COLS);
+  out.print(": grid ");
+  out.print((unsigned long)GRID_MODEL_BITS_BYTES);
+  out.print(" B, path ");
+  out.print((unsigned long)GRID_MODEL_PATH_BYTES);
+  out.print(" B, index ");
+  out.print((unsigned long)GRID_MODEL_INDEX_BYTES);
+  out.print(" B, total ");
+  out.print((unsigned long)sizeof(GridModel));
+  out.println(" B");
+}
+
 Direction GridModel::getNextDirection() {
   // If we're at the last cell, there's no next direction
   if (isPathComplete()) {
     return getCurrentDirection(); // Return current direction as fallback
   }
   
-  // Get current and next path cells
-  PathCell current = getCurrentPathCell();
-  PathCell next = getNextPathCell();
-  
-  // Calculate direction between them
-  if (next.row < current.row) return UP;    // Up
-  if (next.col > current.col) return RIGHT; // Right
-  if (next.row > current.row) return DOWN;  // Down
-  if (next.col < current.col) return LEFT;  // Left
-  return getCurrentDirection();             // No change
+  // Step leaving the current cell is stored directly in the path
+  return path.stepDirection(currentPathIndex);
 } 
\ No newline at end of file
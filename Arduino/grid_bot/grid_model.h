@@ -2,20 +2,20 @@
 #define GRID_MODEL_H
 
 #include <Arduino.h>
+#include "packed_path.h"
 
-// Direction enum for grid movement
-enum Direction {
-    UP = 0,
-    RIGHT = 1,
-    DOWN = 2,
-    LEFT = 3
-};
+// Cells in the default path, undo never removes these
+const int DEFAULT_PATH_LENGTH = 2;
 
-// Path cell structure
-struct PathCell {
-  int row;
-  int col;
-};
+// SRAM budget for a GridModel instance, checked at compile time
+#ifndef GRID_MODEL_SRAM_BUDGET
+#define GRID_MODEL_SRAM_BUDGET 512
+#endif
+
+// Grid storage word, cell values are packed one bit per cell
+typedef uint32_t GridWord;
+const int GRID_WORD_BITS = 32;
+const long GRID_WORDS = (GRID_MAX_CELLS + GRID_WORD_BITS - 1) / GRID_WORD_BITS;
 
 class GridModel {
 private:
@@ -23,12 +23,15 @@ private:
   int numRows;
   int numCols;
   
-  // Grid data
-  bool** gridVals;
+  // Grid data, row-major bitset of cell values
+  GridWord gridBits[GRID_WORDS];
+
+  // Cells whose appearance changed since the last redraw, same layout as gridBits
+  GridWord dirtyBits[GRID_WORDS];
   
-  // Path data
-  PathCell* path;
-  int pathLength;
+  // Path data, stored as direction-coded steps
+  PackedPath path;
+  PathPos pathIndex[GRID_MAX_CELLS];
   int currentPathIndex;
   Direction currentDirection;
   
@@ -44,6 +47,10 @@ public:
   
   // Path manipulation methods
   void pathAdd(int row, int col);
+  void setPath(const PackedPath &newPath);
+  bool pathPop();
+  bool pathRedo();
+  int getRedoLength();
   bool isSelectable(int row, int col);
   void resetPath();
   
@@ -51,10 +58,12 @@ public:
   bool getGridValue(int row, int col);
   void setGridValue(int row, int col, bool value);
   bool isCellActivated(int row, int col);
+  int countSetCells();
+  PathCell findFreeNeighbor(int row, int col);
   
   // Path access methods
   PathCell getPathCell(int index);
-  PathCell* getPath();
+  const PackedPath& getPath();
   int getPathLength();
   int getCurrentPathIndex();
   void setCurrentPathIndex(int index);
@@ -62,6 +71,20 @@ public:
   PathCell getNextPathCell();
   bool isPathComplete();
   
+  // Dirty cell tracking methods
+  void markCellDirty(int row, int col);
+  void clearCellDirty(int row, int col);
+  void markCellAndNeighborsDirty(int row, int col);
+  void markPathDirty(int fromIndex, int toIndex);
+  void markAllDirty();
+  bool isCellDirty(int row, int col);
+  bool hasDirtyCells();
+  void clearDirty();
+  
+  // Per-cell path lookup methods
+  int pathIndexAt(int row, int col);
+  PathCell nextCellOf(int row, int col);
+  
   // Direction methods
   Direction getCurrentDirection();
   void setCurrentDirection(Direction direction);
@@ -74,6 +97,22 @@ public:
   // Utility methods
   bool isInGridBounds(int row, int col);
   void clearAll();
+  static void printMemoryReport(Print &out);
+
+private:
+  // Offset of a cell in row-major per-cell arrays
+  int cellOffset(int row, int col);
+
+  // Bitset access by cell offset
+  static bool testBit(const GridWord* bits, int offset);
+  static void writeBit(GridWord* bits, int offset, bool value);
 };
 
+// Static SRAM report for the model
+const size_t GRID_MODEL_BITS_BYTES = 2 * sizeof(GridWord) * GRID_WORDS;
+const size_t GRID_MODEL_PATH_BYTES = sizeof(PackedPath);
+const size_t GRID_MODEL_INDEX_BYTES = sizeof(PathPos) * GRID_MAX_CELLS;
+static_assert(sizeof(GridModel) <= GRID_MODEL_SRAM_BUDGET,
+              "GridModel exceeds GRID_MODEL_SRAM_BUDGET, reduce GRID_MAX_ROWS/GRID_MAX_COLS");
+
 #endif // GRID_MODEL_H 
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef GRID_TYPES_H
+#define GRID_TYPES_H
+
+#include <Arduino.h>
+
+// Direction enum for grid movement
+enum Direction {
+    UP = 0,
+    RIGHT = 1,
+    DOWN = 2,
+    LEFT = 3
+};
+
+// Grid capacity, sized for the 240x320 display layout with 30 px cells.
+// Override at build time to model larger virtual grids.
+#ifndef GRID_MAX_ROWS
+#define GRID_MAX_ROWS 9
+#endif
+#ifndef GRID_MAX_COLS
+#define GRID_MAX_COLS 7
+#endif
+
+const long GRID_MAX_CELLS = (long)GRID_MAX_ROWS * GRID_MAX_COLS;
+
+// Selects the smallest signed integer type holding values up to a limit
+template <bool Fits8, bool Fits16>
+struct SmallestSigned { typedef int32_t type; };
+template <bool Fits16>
+struct SmallestSigned<true, Fits16> { typedef int8_t type; };
+template <>
+struct SmallestSigned<false, true> { typedef int16_t type; };
+
+// Row/col coordinate type, signed so -1 can mark an invalid cell
+typedef SmallestSigned<(GRID_MAX_ROWS <= 127 && GRID_MAX_COLS <= 127),
+                       (GRID_MAX_ROWS <= 32767 && GRID_MAX_COLS <= 32767)>::type GridCoord;
+
+// Path position type, signed so -1 can mark cells not on the path
+typedef SmallestSigned<(GRID_MAX_CELLS <= 127), (GRID_MAX_CELLS <= 32767)>::type PathPos;
+
+// Path cell structure
+struct PathCell {
+  GridCoord row;
+  GridCoord col;
+};
+
+// Cell one step from a cell in a direction
+inline PathCell stepCell(PathCell cell, Direction direction) {
+  switch (direction) {
+    case UP: cell.row -= 1; break;
+    case RIGHT: cell.col += 1; break;
+    case DOWN: cell.row += 1; break;
+    case LEFT: cell.col -= 1; break;
+  }
+  return cell;
+}
+
+// Direction pointing the opposite way
+inline Direction oppositeDirection(Direction direction) {
+  return (Direction)((direction + 2) & 3);
+}
+
+#endif // GRID_TYPES_H
@@ -0,0 +1,178 @@
+#ifndef HOST_FRAMEBUFFER_H
+#define HOST_FRAMEBUFFER_H
+
+#include <Adafruit_GFX.h>
+#include <stdio.h>
+
+// Colours the UI takes from the ILI9341 driver header
+#ifndef ILI9341_BLACK
+#define ILI9341_BLACK 0x0000
+#define ILI9341_DARKGREY 0x7BEF
+#define ILI9341_WHITE 0xFFFF
+#endif
+
+// Bus traffic the same calls would cause on an ILI9341
+struct HostBusStats {
+  unsigned long transactions;    // startWrite/endWrite pairs, explicit or implied
+  unsigned long addressWindows;  // CASET/PASET/RAMWR sequences
+  unsigned long pixels;          // Pixels sent after a window
+
+  // Bytes on the wire: 11 per address window, 2 per pixel
+  unsigned long bytes() const { return addressWindows * 11 + pixels * 2; }
+  // Transfer time at an SPI clock in Hz, ignoring gaps between bytes
+  double spiMicros(double clockHz) const { return bytes() * 8.0 * 1e6 / clockHz; }
+};
+
+// In-memory RGB565 stand-in for Adafruit_ILI9341, used for host builds
+// (GRID_BOT_HOST). It provides the SPITFT streaming calls the UI uses on top
+// of Adafruit_GFX, counts the bus traffic they would cause and can dump the
+// screen as a PPM image.
+class HostFramebuffer : public Adafruit_GFX {
+public:
+  static const int WIDTH = 240;
+  static const int HEIGHT = 320;
+
+  HostFramebuffer() : Adafruit_GFX(WIDTH, HEIGHT), windowX(0), windowY(0), windowW(0), windowH(0),
+                      windowPos(0), writeDepth(0) {
+    fillScreen(0);
+    resetStats();
+  }
+
+  void resetStats() {
+    stats.transactions = 0;
+    stats.addressWindows = 0;
+    stats.pixels = 0;
+  }
+  const HostBusStats &getStats() const { return stats; }
+
+  // Transactions nest like the SPITFT ones, only the outermost is counted
+  void startWrite() override {
+    if (writeDepth++ == 0) {
+      stats.transactions++;
+    }
+  }
+  void endWrite() override {
+    if (writeDepth > 0) {
+      writeDepth--;
+    }
+  }
+
+  void drawPixel(int16_t px, int16_t py, uint16_t color) override {
+    startWrite();
+    writePixel(px, py, color);
+    endWrite();
+  }
+  void writePixel(int16_t px, int16_t py, uint16_t color) override {
+    stats.addressWindows++;
+    stats.pixels++;
+    setPixel(px, py, color);
+  }
+
+  void fillScreen(uint16_t color) override {
+    fillRect(0, 0, WIDTH, HEIGHT, color);
+  }
+
+  // Rectangle primitives, each one address window and a run of pixels
+  void writeFillRect(int16_t rx, int16_t ry, int16_t w, int16_t h, uint16_t color) override {
+    int left = max((int)rx, 0);
+    int right = min(rx + w, WIDTH);
+    int top = max((int)ry, 0);
+    int bottom = min(ry + h, HEIGHT);
+    if (left >= right || top >= bottom) {
+      return;
+    }
+    stats.addressWindows++;
+    stats.pixels += (unsigned long)(right - left) * (bottom - top);
+    for (int py = top; py < bottom; py++) {
+      for (int px = left; px < right; px++) {
+        pixels[py * WIDTH + px] = color;
+      }
+    }
+  }
+  void writeFastHLine(int16_t lx, int16_t ly, int16_t w, uint16_t color) override { writeFillRect(lx, ly, w, 1, color); }
+  void writeFastVLine(int16_t lx, int16_t ly, int16_t h, uint16_t color) override { writeFillRect(lx, ly, 1, h, color); }
+  void fillRect(int16_t rx, int16_t ry, int16_t w, int16_t h, uint16_t color) override {
+    startWrite();
+    writeFillRect(rx, ry, w, h, color);
+    endWrite();
+  }
+  void drawFastHLine(int16_t lx, int16_t ly, int16_t w, uint16_t color) override { fillRect(lx, ly, w, 1, color); }
+  void drawFastVLine(int16_t lx, int16_t ly, int16_t h, uint16_t color) override { fillRect(lx, ly, 1, h, color); }
+
+  // Streaming interface of Adafruit_SPITFT, pixels fill the address window
+  // left to right, top to bottom
+  void setAddrWindow(uint16_t wx, uint16_t wy, uint16_t w, uint16_t h) {
+    stats.addressWindows++;
+    windowX = wx;
+    windowY = wy;
+    windowW = w;
+    windowH = h;
+    windowPos = 0;
+  }
+
+  void writeColor(uint16_t color, uint32_t len) {
+    stats.pixels += len;
+    while (len-- > 0) {
+      pushPixel(color);
+    }
+  }
+
+  // Transfers complete at once, so a non-blocking call needs no dmaWait()
+  void writePixels(uint16_t *colors, uint32_t len, bool /* block */ = true, bool bigEndian = false) {
+    stats.pixels += len;
+    for (uint32_t i = 0; i < len; i++) {
+      pushPixel(bigEndian ? (uint16_t)((colors[i] << 8) | (colors[i] >> 8)) : colors[i]);
+    }
+  }
+
+  void dmaWait() {}
+
+  uint16_t getPixel(int px, int py) const {
+    return pixels[py * WIDTH + px];
+  }
+
+  // Write the screen as a binary PPM, returns false if the file cannot be written
+  bool savePPM(const char *path) const {
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+      return false;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", WIDTH, HEIGHT);
+    for (long i = 0; i < (long)WIDTH * HEIGHT; i++) {
+      uint16_t c = pixels[i];
+      unsigned char rgb[3] = {
+        (unsigned char)(((c >> 11) & 0x1F) * 255 / 31),
+        (unsigned char)(((c >> 5) & 0x3F) * 255 / 63),
+        (unsigned char)((c & 0x1F) * 255 / 31)
+      };
+      fwrite(rgb, 1, 3, file);
+    }
+    return fclose(file) == 0;
+  }
+
+private:
+  uint16_t pixels[WIDTH * HEIGHT];
+  HostBusStats stats;
+  int windowX;
+  int windowY;
+  int windowW;
+  int windowH;
+  long windowPos;
+  int writeDepth;
+
+  void setPixel(int px, int py, uint16_t color) {
+    if (px >= 0 && px < WIDTH && py >= 0 && py < HEIGHT) {
+      pixels[py * WIDTH + px] = color;
+    }
+  }
+
+  void pushPixel(uint16_t color) {
+    if (windowW == 0 || windowPos >= (long)windowW * windowH) {
+      return;
+    }
+    setPixel(windowX + windowPos % windowW, windowY + windowPos / windowW, color);
+    windowPos++;
+  }
+};
+
+#endif
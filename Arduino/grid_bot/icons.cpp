@@ -1,80 +1,121 @@
 #include "icons.h"
 
-const uint16_t UNDO_ICON[] PROGMEM = {
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xB596, 0xCE79, 0xE71C, 0xF7BE, 0xF7BE, 0xE71C, 0xCE59, 0xAD75,  // 0x0010 (16) pixels
-  0x8C51, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xDEDB, 0xE73C, 0x8C71, 0x7BCF, 0x7BCF, 0x7BEF, 0xC638, 0xFFDF,  // 0x0020 (32) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0030 (48) pixels
-  0xFFFF, 0xFFFF, 0xF79E, 0x8C71, 0x9CF3, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0040 (64) pixels
-  0xFFFF, 0xFFFF, 0xEF5D, 0x9CF3, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0050 (80) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0060 (96) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xCE59, 0xAD75, 0x8C71, 0x8C71, 0xB596, 0xCE79, 0xF79E,  // 0x0070 (112) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x7BCF, 0x7BCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A,  // 0x0080 (128) pixels
-  0x8430, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8430, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x7BEF, 0x7BCF,  // 0x0090 (144) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x00A0 (160) pixels
-  0x7BCF, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x7BCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D,  // 0x00B0 (176) pixels
-  0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71,  // 0x00C0 (192) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x00D0 (208) pixels
-  0x7BCF, 0x7BCF, 0x8430, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x00E0 (224) pixels
-  0xDEDB, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59,  // 0x00F0 (240) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0100 (256) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0110 (272) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE,  // 0x0120 (288) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0130 (304) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0140 (320) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C,  // 0x0150 (336) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0160 (352) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0170 (368) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8430, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596,  // 0x0180 (384) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x9CF3, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0190 (400) pixels
-  0x7BCF, 0x7BCF, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0xE71C, 0xFFFF, 0xC638, 0x7BCF,  // 0x01A0 (416) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x7BCF,  // 0x01B0 (432) pixels
-  0x7BCF, 0x7BCF, 0x7BEF, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x8410, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8430,  // 0x01C0 (448) pixels
-  0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0xA514, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x01D0 (464) pixels
-  0xF79E, 0xD6BA, 0xBDD7, 0x9492, 0x8C71, 0xB596, 0xCE79, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x7BCF, 0x7BCF,  // 0x01E0 (480) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x01F0 (496) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB5B6, 0xFFDF, 0xFFFF, 0xFFFF,  // 0x0200 (512) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x9CF3, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0210 (528) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0220 (544) pixels
-  0xFFFF, 0xC638, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71,  // 0x0230 (560) pixels
-  0xC618, 0xE73C, 0xF79E, 0xFFDF, 0xF7BE, 0xE71C, 0xCE59, 0xAD75, 0x8C51, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0240 (576) pixels
+// Generated by tools/compress_icons.py from tools/icon_sources.c
+// 24x24, 8-bit palette runs, 422 bytes (raw 1152 bytes)
+const uint8_t UNDO_ICON[] PROGMEM = {
+  0x18, 0x18, 0x01, 0x1D, 0xCF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x30, 0x84, 0x51, 0x8C, 0x71, 0x8C,
+  0x92, 0x94, 0xF3, 0x9C, 0x14, 0xA5, 0x75, 0xAD, 0x96, 0xB5, 0xB6, 0xB5, 0xD7, 0xBD, 0xF7, 0xBD,
+  0x18, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x9A, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0x1C, 0xE7,
+  0x3C, 0xE7, 0x5D, 0xEF, 0x7D, 0xEF, 0x9E, 0xF7, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+  0x01, 0x05, 0x01, 0x0A, 0x01, 0x11, 0x01, 0x15, 0x02, 0x1A, 0x01, 0x15, 0x01, 0x10, 0x01, 0x09,
+  0x01, 0x04, 0x07, 0x00, 0x01, 0x14, 0x01, 0x16, 0x01, 0x05, 0x02, 0x00, 0x01, 0x01, 0x01, 0x0F,
+  0x01, 0x1B, 0x09, 0x1C, 0x01, 0x0F, 0x01, 0x01, 0x05, 0x00, 0x02, 0x1C, 0x01, 0x19, 0x01, 0x05,
+  0x01, 0x07, 0x01, 0x18, 0x0C, 0x1C, 0x01, 0x17, 0x01, 0x07, 0x04, 0x00, 0x03, 0x1C, 0x01, 0x1A,
+  0x10, 0x1C, 0x01, 0x0D, 0x03, 0x00, 0x08, 0x1C, 0x01, 0x1A, 0x01, 0x10, 0x01, 0x09, 0x02, 0x05,
+  0x01, 0x0A, 0x01, 0x11, 0x01, 0x19, 0x05, 0x1C, 0x01, 0x07, 0x02, 0x00, 0x07, 0x1C, 0x01, 0x12,
+  0x01, 0x03, 0x06, 0x00, 0x01, 0x03, 0x01, 0x12, 0x04, 0x1C, 0x01, 0x18, 0x01, 0x01, 0x01, 0x00,
+  0x06, 0x1C, 0x01, 0x19, 0x01, 0x05, 0x09, 0x00, 0x01, 0x0A, 0x04, 0x1C, 0x01, 0x10, 0x01, 0x00,
+  0x07, 0x1C, 0x01, 0x18, 0x01, 0x05, 0x09, 0x00, 0x01, 0x12, 0x04, 0x1C, 0x01, 0x05, 0x08, 0x1C,
+  0x01, 0x16, 0x09, 0x00, 0x01, 0x03, 0x01, 0x19, 0x03, 0x1C, 0x01, 0x0A, 0x01, 0x15, 0x07, 0x1C,
+  0x01, 0x14, 0x0A, 0x00, 0x01, 0x11, 0x03, 0x1C, 0x01, 0x10, 0x13, 0x00, 0x01, 0x0A, 0x03, 0x1C,
+  0x01, 0x15, 0x13, 0x00, 0x01, 0x05, 0x03, 0x1C, 0x01, 0x1A, 0x13, 0x00, 0x01, 0x05, 0x03, 0x1C,
+  0x01, 0x1A, 0x13, 0x00, 0x01, 0x0A, 0x03, 0x1C, 0x01, 0x15, 0x13, 0x00, 0x01, 0x11, 0x03, 0x1C,
+  0x01, 0x10, 0x12, 0x00, 0x01, 0x03, 0x01, 0x19, 0x03, 0x1C, 0x01, 0x0A, 0x04, 0x00, 0x01, 0x01,
+  0x01, 0x07, 0x0C, 0x00, 0x01, 0x12, 0x04, 0x1C, 0x01, 0x05, 0x03, 0x00, 0x01, 0x01, 0x01, 0x15,
+  0x01, 0x1C, 0x01, 0x0F, 0x0A, 0x00, 0x01, 0x0A, 0x04, 0x1C, 0x01, 0x10, 0x03, 0x00, 0x01, 0x01,
+  0x01, 0x15, 0x03, 0x1C, 0x01, 0x14, 0x01, 0x02, 0x06, 0x00, 0x01, 0x03, 0x01, 0x12, 0x04, 0x1C,
+  0x01, 0x18, 0x01, 0x01, 0x03, 0x00, 0x01, 0x08, 0x05, 0x1C, 0x01, 0x19, 0x01, 0x13, 0x01, 0x0C,
+  0x01, 0x06, 0x01, 0x05, 0x01, 0x0A, 0x01, 0x11, 0x01, 0x19, 0x05, 0x1C, 0x01, 0x07, 0x05, 0x00,
+  0x01, 0x0C, 0x10, 0x1C, 0x01, 0x0D, 0x07, 0x00, 0x01, 0x0B, 0x01, 0x1B, 0x0C, 0x1C, 0x01, 0x17,
+  0x01, 0x07, 0x09, 0x00, 0x01, 0x05, 0x01, 0x14, 0x0A, 0x1C, 0x01, 0x0F, 0x01, 0x01, 0x0C, 0x00,
+  0x01, 0x05, 0x01, 0x0E, 0x01, 0x16, 0x01, 0x19, 0x01, 0x1B, 0x01, 0x1A, 0x01, 0x15, 0x01, 0x10,
+  0x01, 0x09, 0x01, 0x04, 0x07, 0x00,
 };
 
+// 24x24, 8-bit palette runs, 416 bytes (raw 1152 bytes)
+const uint8_t REDO_ICON[] PROGMEM = {
+  0x18, 0x18, 0x01, 0x1D, 0xCF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x30, 0x84, 0x51, 0x8C, 0x71, 0x8C,
+  0x92, 0x94, 0xF3, 0x9C, 0x14, 0xA5, 0x75, 0xAD, 0x96, 0xB5, 0xB6, 0xB5, 0xD7, 0xBD, 0xF7, 0xBD,
+  0x18, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x9A, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0x1C, 0xE7,
+  0x3C, 0xE7, 0x5D, 0xEF, 0x7D, 0xEF, 0x9E, 0xF7, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+  0x01, 0x04, 0x01, 0x09, 0x01, 0x10, 0x01, 0x15, 0x02, 0x1A, 0x01, 0x15, 0x01, 0x11, 0x01, 0x0A,
+  0x01, 0x05, 0x0C, 0x00, 0x01, 0x01, 0x01, 0x0F, 0x09, 0x1C, 0x01, 0x1B, 0x01, 0x0F, 0x01, 0x01,
+  0x02, 0x00, 0x01, 0x05, 0x01, 0x16, 0x01, 0x14, 0x04, 0x00, 0x01, 0x07, 0x01, 0x17, 0x0C, 0x1C,
+  0x01, 0x18, 0x01, 0x07, 0x01, 0x05, 0x01, 0x19, 0x02, 0x1C, 0x03, 0x00, 0x01, 0x0D, 0x10, 0x1C,
+  0x01, 0x1A, 0x03, 0x1C, 0x02, 0x00, 0x01, 0x07, 0x05, 0x1C, 0x01, 0x19, 0x01, 0x11, 0x01, 0x0A,
+  0x02, 0x05, 0x01, 0x09, 0x01, 0x10, 0x01, 0x1A, 0x08, 0x1C, 0x01, 0x00, 0x01, 0x01, 0x01, 0x18,
+  0x04, 0x1C, 0x01, 0x12, 0x01, 0x03, 0x06, 0x00, 0x01, 0x03, 0x01, 0x12, 0x07, 0x1C, 0x01, 0x00,
+  0x01, 0x10, 0x04, 0x1C, 0x01, 0x0A, 0x09, 0x00, 0x01, 0x05, 0x01, 0x19, 0x06, 0x1C, 0x01, 0x05,
+  0x04, 0x1C, 0x01, 0x12, 0x09, 0x00, 0x01, 0x05, 0x01, 0x18, 0x07, 0x1C, 0x01, 0x0A, 0x03, 0x1C,
+  0x01, 0x19, 0x01, 0x03, 0x09, 0x00, 0x01, 0x16, 0x08, 0x1C, 0x01, 0x10, 0x03, 0x1C, 0x01, 0x11,
+  0x0A, 0x00, 0x01, 0x14, 0x07, 0x1C, 0x02, 0x15, 0x03, 0x1C, 0x01, 0x0A, 0x13, 0x00, 0x01, 0x1A,
+  0x03, 0x1C, 0x01, 0x05, 0x13, 0x00, 0x01, 0x1A, 0x03, 0x1C, 0x01, 0x05, 0x13, 0x00, 0x01, 0x15,
+  0x03, 0x1C, 0x01, 0x0A, 0x13, 0x00, 0x01, 0x10, 0x03, 0x1C, 0x01, 0x11, 0x13, 0x00, 0x01, 0x0A,
+  0x03, 0x1C, 0x01, 0x19, 0x01, 0x03, 0x12, 0x00, 0x01, 0x05, 0x04, 0x1C, 0x01, 0x12, 0x0C, 0x00,
+  0x01, 0x07, 0x01, 0x01, 0x05, 0x00, 0x01, 0x10, 0x04, 0x1C, 0x01, 0x0A, 0x0A, 0x00, 0x01, 0x0F,
+  0x01, 0x1C, 0x01, 0x15, 0x01, 0x01, 0x04, 0x00, 0x01, 0x01, 0x01, 0x18, 0x04, 0x1C, 0x01, 0x12,
+  0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x14, 0x03, 0x1C, 0x01, 0x15, 0x01, 0x01, 0x04, 0x00,
+  0x01, 0x07, 0x05, 0x1C, 0x01, 0x19, 0x01, 0x11, 0x01, 0x0A, 0x01, 0x05, 0x01, 0x06, 0x01, 0x0C,
+  0x01, 0x13, 0x01, 0x19, 0x05, 0x1C, 0x01, 0x08, 0x05, 0x00, 0x01, 0x0D, 0x10, 0x1C, 0x01, 0x0C,
+  0x07, 0x00, 0x01, 0x07, 0x01, 0x17, 0x0C, 0x1C, 0x01, 0x1B, 0x01, 0x0B, 0x09, 0x00, 0x01, 0x01,
+  0x01, 0x0F, 0x0A, 0x1C, 0x01, 0x14, 0x01, 0x05, 0x0C, 0x00, 0x01, 0x04, 0x01, 0x09, 0x01, 0x10,
+  0x01, 0x15, 0x01, 0x1A, 0x01, 0x1B, 0x01, 0x19, 0x01, 0x16, 0x01, 0x0E, 0x01, 0x05, 0x07, 0x00,
+};
+
+// 24x24, 8-bit palette runs, 426 bytes (raw 1152 bytes)
+const uint8_t SETTINGS_ICON[] PROGMEM = {
+  0x18, 0x18, 0x01, 0x1A, 0xCF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x51, 0x8C, 0x71, 0x8C, 0xB2, 0x94,
+  0xD3, 0x9C, 0xF3, 0x9C, 0x55, 0xAD, 0x75, 0xAD, 0x96, 0xB5, 0xB6, 0xB5, 0xD7, 0xBD, 0xF7, 0xBD,
+  0x18, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0x9A, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0x1C, 0xE7, 0x3C, 0xE7,
+  0x5D, 0xEF, 0x9E, 0xF7, 0xBE, 0xF7, 0xFF, 0xFF, 0x08, 0x00, 0x01, 0x06, 0x01, 0x18, 0x04, 0x19,
+  0x01, 0x18, 0x01, 0x06, 0x10, 0x00, 0x01, 0x0E, 0x06, 0x19, 0x01, 0x0F, 0x10, 0x00, 0x01, 0x12,
+  0x06, 0x19, 0x01, 0x12, 0x0A, 0x00, 0x01, 0x02, 0x01, 0x0E, 0x01, 0x09, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x02, 0x01, 0x16, 0x06, 0x19, 0x01, 0x16, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x09,
+  0x01, 0x0E, 0x01, 0x01, 0x04, 0x00, 0x01, 0x11, 0x02, 0x19, 0x01, 0x18, 0x01, 0x10, 0x01, 0x17,
+  0x08, 0x19, 0x01, 0x17, 0x01, 0x10, 0x01, 0x18, 0x02, 0x19, 0x01, 0x10, 0x03, 0x00, 0x01, 0x05,
+  0x14, 0x19, 0x01, 0x05, 0x02, 0x00, 0x01, 0x14, 0x14, 0x19, 0x01, 0x13, 0x01, 0x00, 0x01, 0x08,
+  0x16, 0x19, 0x01, 0x08, 0x01, 0x12, 0x08, 0x19, 0x01, 0x18, 0x01, 0x0C, 0x02, 0x04, 0x01, 0x0B,
+  0x01, 0x18, 0x08, 0x19, 0x01, 0x12, 0x01, 0x07, 0x01, 0x18, 0x06, 0x19, 0x01, 0x18, 0x01, 0x04,
+  0x04, 0x00, 0x01, 0x03, 0x01, 0x18, 0x06, 0x19, 0x01, 0x18, 0x01, 0x07, 0x01, 0x00, 0x01, 0x04,
+  0x01, 0x15, 0x05, 0x19, 0x01, 0x0C, 0x06, 0x00, 0x01, 0x0B, 0x05, 0x19, 0x01, 0x15, 0x01, 0x04,
+  0x03, 0x00, 0x01, 0x04, 0x05, 0x19, 0x01, 0x04, 0x06, 0x00, 0x01, 0x04, 0x05, 0x19, 0x01, 0x04,
+  0x04, 0x00, 0x01, 0x04, 0x05, 0x19, 0x01, 0x04, 0x06, 0x00, 0x01, 0x04, 0x05, 0x19, 0x01, 0x04,
+  0x03, 0x00, 0x01, 0x04, 0x01, 0x15, 0x05, 0x19, 0x01, 0x0C, 0x06, 0x00, 0x01, 0x0B, 0x05, 0x19,
+  0x01, 0x15, 0x01, 0x04, 0x01, 0x00, 0x01, 0x07, 0x01, 0x18, 0x06, 0x19, 0x01, 0x18, 0x01, 0x04,
+  0x04, 0x00, 0x01, 0x03, 0x01, 0x18, 0x06, 0x19, 0x01, 0x18, 0x01, 0x07, 0x01, 0x12, 0x08, 0x19,
+  0x01, 0x18, 0x01, 0x0C, 0x02, 0x04, 0x01, 0x0B, 0x01, 0x18, 0x08, 0x19, 0x01, 0x12, 0x01, 0x08,
+  0x16, 0x19, 0x01, 0x09, 0x01, 0x00, 0x01, 0x13, 0x14, 0x19, 0x01, 0x14, 0x02, 0x00, 0x01, 0x05,
+  0x14, 0x19, 0x01, 0x05, 0x03, 0x00, 0x01, 0x10, 0x02, 0x19, 0x01, 0x18, 0x01, 0x10, 0x01, 0x17,
+  0x08, 0x19, 0x01, 0x17, 0x01, 0x10, 0x01, 0x18, 0x02, 0x19, 0x01, 0x11, 0x04, 0x00, 0x01, 0x01,
+  0x01, 0x0E, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x01, 0x16, 0x06, 0x19, 0x01, 0x16,
+  0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x09, 0x01, 0x0D, 0x01, 0x01, 0x0A, 0x00, 0x01, 0x12,
+  0x06, 0x19, 0x01, 0x12, 0x10, 0x00, 0x01, 0x0E, 0x06, 0x19, 0x01, 0x0F, 0x10, 0x00, 0x01, 0x05,
+  0x01, 0x18, 0x04, 0x19, 0x01, 0x18, 0x01, 0x06, 0x08, 0x00,
+};
+
+// 24x24, 8-bit palette runs, 226 bytes (raw 1152 bytes)
+const uint8_t OPTIMIZE_ICON[] PROGMEM = {
+  0x18, 0x18, 0x01, 0x11, 0xCF, 0x7B, 0x10, 0x84, 0x51, 0x8C, 0x92, 0x94, 0xD3, 0x9C, 0x14, 0xA5,
+  0x55, 0xAD, 0x96, 0xB5, 0xD7, 0xBD, 0x38, 0xC6, 0x79, 0xCE, 0xBA, 0xD6, 0xFB, 0xDE, 0x3C, 0xE7,
+  0x7D, 0xEF, 0xBE, 0xF7, 0xFF, 0xFF, 0x25, 0x00, 0x01, 0x06, 0x01, 0x10, 0x01, 0x0D, 0x14, 0x00,
+  0x01, 0x02, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x07, 0x14, 0x00, 0x01, 0x0D, 0x02, 0x10, 0x01, 0x02,
+  0x13, 0x00, 0x01, 0x08, 0x02, 0x10, 0x01, 0x0D, 0x13, 0x00, 0x01, 0x04, 0x03, 0x10, 0x01, 0x06,
+  0x12, 0x00, 0x01, 0x01, 0x01, 0x0E, 0x03, 0x10, 0x01, 0x01, 0x12, 0x00, 0x01, 0x0B, 0x03, 0x10,
+  0x01, 0x0B, 0x12, 0x00, 0x01, 0x07, 0x04, 0x10, 0x01, 0x06, 0x11, 0x00, 0x01, 0x03, 0x01, 0x0F,
+  0x04, 0x10, 0x01, 0x09, 0x04, 0x08, 0x01, 0x07, 0x0C, 0x00, 0x01, 0x0D, 0x0A, 0x10, 0x01, 0x04,
+  0x0B, 0x00, 0x01, 0x09, 0x0A, 0x10, 0x01, 0x08, 0x0B, 0x00, 0x01, 0x04, 0x0A, 0x10, 0x01, 0x0C,
+  0x0C, 0x00, 0x01, 0x07, 0x05, 0x08, 0x04, 0x10, 0x01, 0x0F, 0x01, 0x02, 0x11, 0x00, 0x01, 0x04,
+  0x04, 0x10, 0x01, 0x05, 0x12, 0x00, 0x01, 0x07, 0x03, 0x10, 0x01, 0x09, 0x13, 0x00, 0x01, 0x0A,
+  0x02, 0x10, 0x01, 0x0D, 0x14, 0x00, 0x01, 0x0D, 0x01, 0x10, 0x01, 0x0F, 0x01, 0x02, 0x13, 0x00,
+  0x01, 0x01, 0x02, 0x10, 0x01, 0x05, 0x14, 0x00, 0x01, 0x04, 0x01, 0x10, 0x01, 0x09, 0x15, 0x00,
+  0x01, 0x08, 0x01, 0x0D, 0x01, 0x01, 0x15, 0x00, 0x01, 0x0A, 0x01, 0x03, 0x16, 0x00, 0x01, 0x04,
+  0x26, 0x00,
+};
 
-const uint16_t SETTINGS_ICON[] PROGMEM = {
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x9CD3, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9CD3,  // 0x0010 (16) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0020 (32) pixels
-  0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0030 (48) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA,  // 0x0040 (64) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8410, 0xC618, 0xAD75, 0x7BEF, 0x7BCF, 0x8410,  // 0x0050 (80) pixels
-  0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x8410, 0x7BCF, 0x7BEF, 0xAD75, 0xC618, 0x7BEF, 0x7BCF, 0x7BCF,  // 0x0060 (96) pixels
-  0x7BCF, 0x7BCF, 0xD69A, 0xFFFF, 0xFFFF, 0xF7BE, 0xCE79, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0070 (112) pixels
-  0xF79E, 0xCE79, 0xF7BE, 0xFFFF, 0xFFFF, 0xCE79, 0x7BCF, 0x7BCF, 0x7BCF, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0080 (128) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0x7BCF,  // 0x0090 (144) pixels
-  0x7BCF, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x00A0 (160) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x7BCF, 0xAD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x00B0 (176) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD55,  // 0x00C0 (192) pixels
-  0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xBDD7, 0x8C71, 0x8C71, 0xB5B6, 0xF7BE, 0xFFFF,  // 0x00D0 (208) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x9CF3, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x00E0 (224) pixels
-  0xF7BE, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C51, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9CF3,  // 0x00F0 (240) pixels
-  0x7BCF, 0x8C71, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDD7, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB5B6,  // 0x0100 (256) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0110 (272) pixels
-  0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x7BCF, 0x7BCF,  // 0x0120 (288) pixels
-  0x7BCF, 0x7BCF, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71,  // 0x0130 (304) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0140 (320) pixels
-  0xBDD7, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x8C71, 0x7BCF,  // 0x0150 (336) pixels
-  0x9CF3, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C51, 0xF7BE,  // 0x0160 (352) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9CF3, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0170 (368) pixels
-  0xFFFF, 0xF7BE, 0xBDD7, 0x8C71, 0x8C71, 0xB5B6, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA,  // 0x0180 (384) pixels
-  0xAD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0190 (400) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75, 0x7BCF, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x01A0 (416) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x7BCF,  // 0x01B0 (432) pixels
-  0x7BCF, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x01C0 (448) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0x7BCF, 0x7BCF, 0x7BCF, 0xCE79, 0xFFFF, 0xFFFF, 0xF7BE, 0xCE79, 0xF79E,  // 0x01D0 (464) pixels
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xCE79, 0xF7BE, 0xFFFF, 0xFFFF, 0xD69A, 0x7BCF, 0x7BCF,  // 0x01E0 (480) pixels
-  0x7BCF, 0x7BCF, 0x7BEF, 0xC618, 0xB596, 0x7BEF, 0x7BCF, 0x8410, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D,  // 0x01F0 (496) pixels
-  0x8410, 0x7BCF, 0x7BEF, 0xAD75, 0xBDF7, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0200 (512) pixels
-  0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0210 (528) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638,  // 0x0220 (544) pixels
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0230 (560) pixels
-  0x94B2, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9CD3, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0240 (576) pixels
+const uint8_t PATH_GLYPHS[][PATH_GLYPH_SIZE] PROGMEM = {
+  { 0x08, 0x08, 0x1C, 0x1C, 0x3E, 0x3E, 0x7F },  // UP
+  { 0x40, 0x70, 0x7C, 0x7F, 0x7C, 0x70, 0x40 },  // RIGHT
+  { 0x7F, 0x3E, 0x3E, 0x1C, 0x1C, 0x08, 0x08 },  // DOWN
+  { 0x01, 0x07, 0x1F, 0x7F, 0x1F, 0x07, 0x01 },  // LEFT
+  { 0x1C, 0x3E, 0x7F, 0x7F, 0x7F, 0x3E, 0x1C },  // End dot
 };
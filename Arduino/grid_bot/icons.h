@@ -3,9 +3,29 @@
 
 #include <Arduino.h>
 
-// Icon data declarations
-// Arrays of pixel colors for the button icons
-extern const uint16_t UNDO_ICON[] PROGMEM;
-extern const uint16_t SETTINGS_ICON[] PROGMEM;
+// Compressed button icons. Each starts with a four byte header (width,
+// height, format, palette size), then the palette as little-endian RGB565
+// words, then the pixel runs in row order:
+//   ICON_RLE565  count, colour low byte, colour high byte
+//   ICON_PAL8    count, palette index
+//   ICON_PAL4    (count - 1) << 4 | palette index
+// Generate them with tools/compress_icons.py, which picks the smallest format.
+enum IconFormat { ICON_RLE565, ICON_PAL8, ICON_PAL4 };
+const int ICON_WIDTH_OFFSET = 0;
+const int ICON_HEIGHT_OFFSET = 1;
+const int ICON_FORMAT_OFFSET = 2;
+const int ICON_PALETTE_OFFSET = 3;
+const int ICON_HEADER_SIZE = 4;
+
+extern const uint8_t UNDO_ICON[] PROGMEM;
+extern const uint8_t REDO_ICON[] PROGMEM;
+extern const uint8_t SETTINGS_ICON[] PROGMEM;
+extern const uint8_t OPTIMIZE_ICON[] PROGMEM;
+
+// Path glyph masks, one byte per row with the leftmost pixel in bit 6.
+// Arrows are indexed by Direction, followed by the path end dot.
+const int PATH_GLYPH_SIZE = 7;
+const int PATH_GLYPH_END = 4;
+extern const uint8_t PATH_GLYPHS[][PATH_GLYPH_SIZE] PROGMEM;
 
 #endif
@@ -0,0 +1,102 @@
+#include "motion_plan.h"
+
+MotionPlan::MotionPlan() {
+  clear();
+}
+
+void MotionPlan::clear() {
+  numSegments = 0;
+  totalDuration = 0;
+}
+
+bool MotionPlan::compile(GridModel &model, Direction startDirection,
+                         unsigned long forwardMoveTime, unsigned long turnMoveTime) {
+  clear();
+
+  // Walk the path steps, merging steps in the same direction into one run
+  const PackedPath &path = model.getPath();
+  Direction heading = startDirection;
+  int runCells = 0;
+  for (int step = 0; step < path.length() - 1; step++) {
+    Direction stepDirection = path.stepDirection(step);
+
+    // Direction change ends the current run and adds a turn
+    if (stepDirection != heading) {
+      if (runCells > 0 &&
+          !addSegment(SEGMENT_STRAIGHT, 0, heading, runCells, runCells * forwardMoveTime)) {
+        return false;
+      }
+      runCells = 0;
+
+      int turn = calculateTurn(heading, stepDirection);
+      if (!addSegment(SEGMENT_TURN, turn, stepDirection, 0, abs(turn) * turnMoveTime)) {
+        return false;
+      }
+      heading = stepDirection;
+    }
+    runCells += 1;
+  }
+
+  // Close the final run
+  if (runCells > 0) {
+    return addSegment(SEGMENT_STRAIGHT, 0, heading, runCells, runCells * forwardMoveTime);
+  }
+  return true;
+}
+
+bool MotionPlan::addSegment(SegmentType type, int turn, Direction heading, int cells, unsigned long duration) {
+  if (numSegments >= MOTION_PLAN_MAX_SEGMENTS) {
+    return false;
+  }
+  segments[numSegments] = { (uint8_t)type, (int8_t)turn, (uint8_t)heading, (PathPos)cells, (uint32_t)duration };
+  numSegments += 1;
+  totalDuration += duration;
+  return true;
+}
+
+int MotionPlan::getSegmentCount() const {
+  return numSegments;
+}
+
+const MotionSegment& MotionPlan::getSegment(int index) const {
+  return segments[index];
+}
+
+unsigned long MotionPlan::getTotalDuration() const {
+  return totalDuration;
+}
+
+unsigned long MotionPlan::estimateDuration(const PackedPath &path, Direction startDirection,
+                                          unsigned long forwardMoveTime, unsigned long turnMoveTime) {
+  // Each step drives one cell, plus any turn needed to face it
+  unsigned long duration = 0;
+  Direction heading = startDirection;
+  for (int step = 0; step < path.length() - 1; step++) {
+    Direction stepDirection = path.stepDirection(step);
+    duration += abs(calculateTurn(heading, stepDirection)) * turnMoveTime + forwardMoveTime;
+    heading = stepDirection;
+  }
+  return duration;
+}
+
+int MotionPlan::calculateTurn(Direction currentDir, Direction targetDir) {
+  // Calculate difference between current and target direction
+  int diff = static_cast<int>(targetDir) - static_cast<int>(currentDir);
+
+  // Normalize to -1 (left), 1 (right) or 2 (about-face)
+  if (diff == 3) diff = -1;
+  if (diff == -3) diff = 1;
+  if (diff == -2) diff = 2;
+
+  return diff;
+}
+
+void MotionPlan::printMemoryReport(Print &out) {
+  out.print("MotionPlan capacity ");
+  out.print(MOTION_PLAN_MAX_SEGMENTS);
+  out.print(" segments: segments ");
+  out.print((unsigned long)MOTION_PLAN_SEGMENT_BYTES);
+  out.print(" B, total ");
+  out.print((unsigned long)sizeof(MotionPlan));
+  out.println(" B");
+}
@@ -0,0 +1,72 @@
+#ifndef MOTION_PLAN_H
+#define MOTION_PLAN_H
+
+#include <Arduino.h>
+#include "grid_model.h"
+
+// Maximum segments in a plan. A path of N cells has N - 1 steps, and one
+// alternating turns and single steps needs a turn and a straight per step.
+#ifndef MOTION_PLAN_MAX_SEGMENTS
+#define MOTION_PLAN_MAX_SEGMENTS (2 * (GRID_MAX_CELLS - 1))
+#endif
+
+// Static SRAM budget for the motion plan, on top of the GridModel one
+#ifndef MOTION_PLAN_SRAM_BUDGET
+#define MOTION_PLAN_SRAM_BUDGET 1024
+#endif
+
+// Motion segment type
+enum SegmentType {
+  SEGMENT_STRAIGHT,
+  SEGMENT_TURN
+};
+
+// Motion segment structure
+struct MotionSegment {
+  uint8_t type;           // SegmentType
+  int8_t turn;            // Quarter turns, -1 left, 1 right, 2 about-face
+  uint8_t heading;        // Direction faced at the end of the segment
+  PathPos cells;          // Cells driven by a straight segment
+  uint32_t duration;      // Precomputed segment duration in ms
+};
+
+class MotionPlan {
+private:
+  MotionSegment segments[MOTION_PLAN_MAX_SEGMENTS];
+  int numSegments;
+  unsigned long totalDuration;
+
+  // Append a segment, returns false if the plan is full
+  bool addSegment(SegmentType type, int turn, Direction heading, int cells, unsigned long duration);
+
+public:
+  // Constructor
+  MotionPlan();
+
+  // Compile the model path into straight runs and turns
+  bool compile(GridModel &model, Direction startDirection,
+               unsigned long forwardMoveTime, unsigned long turnMoveTime);
+  void clear();
+
+  // Plan access methods
+  int getSegmentCount() const;
+  const MotionSegment& getSegment(int index) const;
+  unsigned long getTotalDuration() const;
+
+  // Estimated run time of a path without building its segments
+  static unsigned long estimateDuration(const PackedPath &path, Direction startDirection,
+                                        unsigned long forwardMoveTime, unsigned long turnMoveTime);
+
+  // Quarter turns from one direction to another, -1 left, 1 right, 2 about-face
+  static int calculateTurn(Direction currentDir, Direction targetDir);
+
+  // Print the static SRAM use of the plan
+  static void printMemoryReport(Print &out);
+};
+
+// Static SRAM report for the plan
+const size_t MOTION_PLAN_SEGMENT_BYTES = sizeof(MotionSegment) * MOTION_PLAN_MAX_SEGMENTS;
+static_assert(sizeof(MotionPlan) <= MOTION_PLAN_SRAM_BUDGET,
+              "MotionPlan exceeds MOTION_PLAN_SRAM_BUDGET, reduce GRID_MAX_ROWS/GRID_MAX_COLS");
+
+#endif // MOTION_PLAN_H
@@ -0,0 +1,134 @@
+#include "packed_path.h"
+
+PackedPath::Iterator& PackedPath::Iterator::operator++() {
+  // Apply the step leaving the current cell
+  if (pos < path->length() - 1) {
+    cell = stepCell(cell, path->stepDirection(pos));
+  }
+  pos += 1;
+  return *this;
+}
+
+PackedPath::PackedPath() {
+  clear();
+}
+
+void PackedPath::clear() {
+  len = 0;
+  redoLen = 0;
+  start = { -1, -1 };
+  tail = { -1, -1 };
+  cursorCell = { -1, -1 };
+  cursorIndex = -1;
+}
+
+bool PackedPath::push(int row, int col) {
+  if (isFull()) {
+    return false;
+  }
+
+  PathCell cell = { (GridCoord)row, (GridCoord)col };
+
+  // First cell becomes the start, later cells must be one step from the tail
+  if (len == 0) {
+    start = cell;
+  } else {
+    int dRow = cell.row - tail.row;
+    int dCol = cell.col - tail.col;
+    Direction direction;
+    if (dRow == -1 && dCol == 0) direction = UP;
+    else if (dRow == 0 && dCol == 1) direction = RIGHT;
+    else if (dRow == 1 && dCol == 0) direction = DOWN;
+    else if (dRow == 0 && dCol == -1) direction = LEFT;
+    else return false; // Not a unit step
+
+    // Re-adding the next popped step keeps the rest of the redo history
+    if (redoLen > 0 && stepDirection(len - 1) == direction) {
+      redoLen -= 1;
+    } else {
+      redoLen = 0;
+    }
+    writeStep(len - 1, direction);
+  }
+
+  tail = cell;
+  len += 1;
+  return true;
+}
+
+void PackedPath::pop() {
+  if (len == 0) {
+    return;
+  }
+
+  // Walk the tail back along its incoming step, the step stays stored for redo
+  len -= 1;
+  if (len == 0) {
+    clear();
+    return;
+  }
+  tail = stepCell(tail, oppositeDirection(stepDirection(len - 1)));
+  redoLen += 1;
+
+  // Drop the cursor if it pointed past the new tail
+  if (cursorIndex >= len) {
+    cursorIndex = -1;
+  }
+}
+
+bool PackedPath::redo() {
+  if (redoLen == 0) {
+    return false;
+  }
+
+  // Replay the stored step leaving the tail
+  tail = stepCell(tail, stepDirection(len - 1));
+  len += 1;
+  redoLen -= 1;
+  return true;
+}
+
+PathCell PackedPath::first() const {
+  return start;
+}
+
+PathCell PackedPath::last() const {
+  return tail;
+}
+
+PathCell PackedPath::cellAt(int index) const {
+  if (index < 0 || index >= len) {
+    return { -1, -1 }; // Invalid cell
+  }
+
+  // Walk from whichever known cell is closest: start, cursor or tail
+  int baseIndex = 0;
+  PathCell cell = start;
+  if (len - 1 - index < index) {
+    baseIndex = len - 1;
+    cell = tail;
+  }
+  if (cursorIndex >= 0 && abs(index - cursorIndex) < abs(index - baseIndex)) {
+    baseIndex = cursorIndex;
+    cell = cursorCell;
+  }
+  for (int i = baseIndex; i < index; i++) {
+    cell = stepCell(cell, stepDirection(i));
+  }
+  for (int i = baseIndex; i > index; i--) {
+    cell = stepCell(cell, oppositeDirection(stepDirection(i - 1)));
+  }
+
+  cursorIndex = index;
+  cursorCell = cell;
+  return cell;
+}
+
+Direction PackedPath::stepDirection(int step) const {
+  return (Direction)((steps[step >> 2] >> ((step & 3) * 2)) & 3);
+}
+
+void PackedPath::writeStep(int step, Direction direction) {
+  uint8_t shift = (step & 3) * 2;
+  steps[step >> 2] = (steps[step >> 2] & ~(3 << shift)) | (direction << shift);
+}
@@ -0,0 +1,70 @@
+#ifndef PACKED_PATH_H
+#define PACKED_PATH_H
+
+#include <Arduino.h>
+#include "grid_types.h"
+
+// Path of unit steps stored as a start cell plus one 2-bit Direction per step
+class PackedPath {
+public:
+  // Forward iterator that rebuilds cells from the start cell
+  class Iterator {
+  public:
+    Iterator(const PackedPath* path, int index, PathCell cell)
+      : path(path), pos(index), cell(cell) {}
+
+    PathCell operator*() const { return cell; }
+    Iterator& operator++();
+    bool operator!=(const Iterator& other) const { return pos != other.pos; }
+
+    int index() const { return pos; }
+
+  private:
+    const PackedPath* path;
+    int pos;
+    PathCell cell;
+  };
+
+  // Constructor
+  PackedPath();
+
+  // Path manipulation methods
+  void clear();
+  bool push(int row, int col);
+  void pop();
+  bool redo();
+
+  // Path access methods
+  int length() const { return len; }
+  bool isEmpty() const { return len == 0; }
+  bool isFull() const { return len >= GRID_MAX_CELLS; }
+  int redoLength() const { return redoLen; }
+  PathCell first() const;
+  PathCell last() const;
+  PathCell cellAt(int index) const;
+  Direction stepDirection(int step) const;
+
+  // Iteration
+  Iterator begin() const { return Iterator(this, 0, start); }
+  Iterator end() const { return Iterator(this, len, start); }
+
+private:
+  // Steps packed four per byte
+  uint8_t steps[(GRID_MAX_CELLS + 3) / 4];
+
+  // Endpoint cells and step count
+  PathCell start;
+  PathCell tail;
+  int len;
+
+  // Popped steps still stored past the tail, bounded by the step capacity
+  int redoLen;
+
+  // Last cell rebuilt by cellAt, makes sequential access O(1)
+  mutable PathCell cursorCell;
+  mutable int cursorIndex;
+
+  void writeStep(int step, Direction direction);
+};
+
+#endif // PACKED_PATH_H
@@ -0,0 +1,201 @@
+#include "path_planner.h"
+
+// Move used to reach a state
+enum PlanMove {
+  MOVE_FORWARD = 0,
+  MOVE_TURN_RIGHT = 1,
+  MOVE_TURN_LEFT = 2
+};
+
+// Heap position markers
+const PlanState HEAP_UNSEEN = -1;
+const PlanState HEAP_SETTLED = -2;
+
+PathPlanner::PathPlanner() {
+  heapSize = 0;
+  routeCost = 0;
+}
+
+bool PathPlanner::findRoute(GridModel &model, PathCell from, Direction heading, PathCell to,
+                            bool avoidPath, unsigned long forwardCost, unsigned long turnCost) {
+  route.clear();
+  routeCost = 0;
+  if (!model.isInGridBounds(from.row, from.col) || !model.isInGridBounds(to.row, to.col)) {
+    return false;
+  }
+
+  // Reset search data for every state of the current grid
+  int numCols = model.getNumCols();
+  long numStates = (long)model.getNumRows() * numCols * 4;
+  for (long i = 0; i < numStates; i++) {
+    cost[i] = 0xFFFFFFFF;
+    heapPos[i] = HEAP_UNSEEN;
+  }
+  heapSize = 0;
+
+  // Dijkstra search over (cell, heading) states
+  PlanState startState = (PlanState)(((long)from.row * numCols + from.col) * 4 + heading);
+  PlanState goalState = -1;
+  cost[startState] = 0;
+  heapPush(startState);
+  while (heapSize > 0) {
+    PlanState state = heapPop();
+    heapPos[state] = HEAP_SETTLED;
+
+    long offset = state / 4;
+    Direction stateHeading = (Direction)(state % 4);
+    PathCell cell = { (GridCoord)(offset / numCols), (GridCoord)(offset % numCols) };
+    if (cell.row == to.row && cell.col == to.col) {
+      goalState = state;
+      break;
+    }
+
+    // Drive one cell forward
+    PathCell next = stepCell(cell, stateHeading);
+    if (model.isInGridBounds(next.row, next.col) &&
+        !(avoidPath && model.getGridValue(next.row, next.col))) {
+      long nextOffset = (long)next.row * numCols + next.col;
+      relax((PlanState)(nextOffset * 4 + stateHeading), cost[state] + forwardCost, MOVE_FORWARD);
+    }
+
+    // Turn a quarter in place
+    relax((PlanState)(offset * 4 + ((stateHeading + 1) & 3)), cost[state] + turnCost, MOVE_TURN_RIGHT);
+    relax((PlanState)(offset * 4 + ((stateHeading + 3) & 3)), cost[state] + turnCost, MOVE_TURN_LEFT);
+  }
+  if (goalState < 0) {
+    return false;
+  }
+  routeCost = cost[goalState];
+
+  // Walk parent moves back to the start, collecting cells goal first
+  reversed.clear();
+  reversed.push(to.row, to.col);
+  PlanState state = goalState;
+  while (state != startState) {
+    long offset = state / 4;
+    Direction stateHeading = (Direction)(state % 4);
+    switch (parentMove(state)) {
+      case MOVE_FORWARD:
+        {
+          PathCell cell = { (GridCoord)(offset / numCols), (GridCoord)(offset % numCols) };
+          PathCell prev = stepCell(cell, oppositeDirection(stateHeading));
+          reversed.push(prev.row, prev.col);
+          state = (PlanState)(((long)prev.row * numCols + prev.col) * 4 + stateHeading);
+          break;
+        }
+      case MOVE_TURN_RIGHT:
+        state = (PlanState)(offset * 4 + ((stateHeading + 3) & 3));
+        break;
+      case MOVE_TURN_LEFT:
+        state = (PlanState)(offset * 4 + ((stateHeading + 1) & 3));
+        break;
+    }
+  }
+
+  // Rebuild the route start first, cellAt walks back from the tail in O(1) steps
+  for (int i = reversed.length() - 1; i >= 0; i--) {
+    PathCell cell = reversed.cellAt(i);
+    route.push(cell.row, cell.col);
+  }
+  return true;
+}
+
+const PackedPath& PathPlanner::getRoute() const {
+  return route;
+}
+
+unsigned long PathPlanner::getRouteCost() const {
+  return routeCost;
+}
+
+void PathPlanner::printMemoryReport(Print &out) {
+  out.print("PathPlanner capacity ");
+  out.print(GRID_MAX_ROWS);
+  out.print("x");
+  out.print(GRID_MAX_COLS);
+  out.print(": costs ");
+  out.print((unsigned long)PATH_PLANNER_COST_BYTES);
+  out.print(" B, moves ");
+  out.print((unsigned long)PATH_PLANNER_MOVE_BYTES);
+  out.print(" B, heap ");
+  out.print((unsigned long)PATH_PLANNER_HEAP_BYTES);
+  out.print(" B, total ");
+  out.print((unsigned long)sizeof(PathPlanner));
+  out.println(" B");
+}
+
+void PathPlanner::relax(PlanState state, PlanCost newCost, uint8_t move) {
+  if (heapPos[state] == HEAP_SETTLED || newCost >= cost[state]) {
+    return;
+  }
+  cost[state] = newCost;
+  setParentMove(state, move);
+  if (heapPos[state] == HEAP_UNSEEN) {
+    heapPush(state);
+  } else {
+    siftUp(heapPos[state]);
+  }
+}
+
+uint8_t PathPlanner::parentMove(PlanState state) const {
+  return (parentMoves[state / 4] >> ((state % 4) * 2)) & 3;
+}
+
+void PathPlanner::setParentMove(PlanState state, uint8_t move) {
+  uint8_t shift = (state % 4) * 2;
+  parentMoves[state / 4] = (uint8_t)((parentMoves[state / 4] & ~(3 << shift)) | (move << shift));
+}
+
+void PathPlanner::heapPush(PlanState state) {
+  heap[heapSize] = state;
+  heapPos[state] = (PlanState)heapSize;
+  heapSize += 1;
+  siftUp(heapSize - 1);
+}
+
+PlanState PathPlanner::heapPop() {
+  PlanState top = heap[0];
+  heapSize -= 1;
+  if (heapSize > 0) {
+    heap[0] = heap[heapSize];
+    heapPos[heap[0]] = 0;
+    siftDown(0);
+  }
+  return top;
+}
+
+void PathPlanner::siftUp(int pos) {
+  PlanState state = heap[pos];
+  while (pos > 0) {
+    int parent = (pos - 1) / 2;
+    if (cost[heap[parent]] <= cost[state]) {
+      break;
+    }
+    heap[pos] = heap[parent];
+    heapPos[heap[pos]] = (PlanState)pos;
+    pos = parent;
+  }
+  heap[pos] = state;
+  heapPos[state] = (PlanState)pos;
+}
+
+void PathPlanner::siftDown(int pos) {
+  PlanState state = heap[pos];
+  while (true) {
+    int child = pos * 2 + 1;
+    if (child >= heapSize) {
+      break;
+    }
+    if (child + 1 < heapSize && cost[heap[child + 1]] < cost[heap[child]]) {
+      child += 1;
+    }
+    if (cost[state] <= cost[heap[child]]) {
+      break;
+    }
+    heap[pos] = heap[child];
+    heapPos[heap[pos]] = (PlanState)pos;
+    pos = child;
+  }
+  heap[pos] = state;
+  heapPos[state] = (PlanState)pos;
+}
@@ -0,0 +1,75 @@
+#ifndef PATH_PLANNER_H
+#define PATH_PLANNER_H
+
+#include <Arduino.h>
+#include "grid_model.h"
+
+// Search states, one per cell and heading
+const long PLAN_MAX_STATES = GRID_MAX_CELLS * 4;
+
+// Static SRAM budget for the planner, on top of the GridModel one
+#ifndef PATH_PLANNER_SRAM_BUDGET
+#define PATH_PLANNER_SRAM_BUDGET 2304
+#endif
+
+// Search state index, signed so negative values can mark heap membership
+typedef SmallestSigned<(PLAN_MAX_STATES <= 127), (PLAN_MAX_STATES <= 32767)>::type PlanState;
+
+// Accumulated route cost in ms
+typedef uint32_t PlanCost;
+
+class PathPlanner {
+private:
+  // Per-state search data. The moves of a cell's four headings share a
+  // byte, two bits each.
+  PlanCost cost[PLAN_MAX_STATES];
+  uint8_t parentMoves[GRID_MAX_CELLS];
+  PlanState heapPos[PLAN_MAX_STATES];
+
+  // Binary min-heap of open states ordered by cost
+  PlanState heap[PLAN_MAX_STATES];
+  int heapSize;
+
+  // Result of the last search
+  PackedPath route;
+  PackedPath reversed;
+  PlanCost routeCost;
+
+  // Heap operations
+  void heapPush(PlanState state);
+  PlanState heapPop();
+  void siftUp(int pos);
+  void siftDown(int pos);
+
+  // Lower the cost of a state reached by a move
+  void relax(PlanState state, PlanCost newCost, uint8_t move);
+
+  // Move that reached a state
+  uint8_t parentMove(PlanState state) const;
+  void setParentMove(PlanState state, uint8_t move);
+
+public:
+  // Constructor
+  PathPlanner();
+
+  // Find the cheapest route from a cell and heading to a target cell,
+  // charging forwardCost per cell and turnCost per quarter turn
+  bool findRoute(GridModel &model, PathCell from, Direction heading, PathCell to,
+                 bool avoidPath, unsigned long forwardCost, unsigned long turnCost);
+
+  // Result access methods
+  const PackedPath& getRoute() const;
+  unsigned long getRouteCost() const;
+
+  // Print the static SRAM use of the planner
+  static void printMemoryReport(Print &out);
+};
+
+// Static SRAM report for the planner
+const size_t PATH_PLANNER_COST_BYTES = sizeof(PlanCost) * PLAN_MAX_STATES;
+const size_t PATH_PLANNER_MOVE_BYTES = GRID_MAX_CELLS;
+const size_t PATH_PLANNER_HEAP_BYTES = 2 * sizeof(PlanState) * PLAN_MAX_STATES;
+static_assert(sizeof(PathPlanner) <= PATH_PLANNER_SRAM_BUDGET,
+              "PathPlanner exceeds PATH_PLANNER_SRAM_BUDGET, reduce GRID_MAX_ROWS/GRID_MAX_COLS");
+
+#endif // PATH_PLANNER_H
@@ -0,0 +1,160 @@
+#include "scheduler.h"
+
+static_assert((SCHEDULER_WHEEL_SLOTS & (SCHEDULER_WHEEL_SLOTS - 1)) == 0,
+              "SCHEDULER_WHEEL_SLOTS must be a power of two");
+
+// Wait for the next interrupt. On SAMD the 1 ms SysTick wakes the core, so
+// the scheduler never oversleeps a tick.
+#if defined(ARDUINO_ARCH_SAMD)
+#define SCHEDULER_IDLE() __WFI()
+#else
+#define SCHEDULER_IDLE() yield()
+#endif
+
+// True if tick a is at or before tick b, across millis() wrap-around
+static bool tickReached(unsigned long a, unsigned long b) {
+  return (long)(a - b) <= 0;
+}
+
+SchedulerTask::SchedulerTask(const char *name, TaskFunction function, unsigned long periodMs, unsigned long deadlineMs)
+  : name(name), function(function), period(periodMs), deadline(deadlineMs),
+    due(0), next(NULL), active(false), linked(false), runs(0), misses(0), maxLateness(0) {}
+
+Scheduler::Scheduler() : taskCount(0), currentTick(0), started(false) {
+  for (int i = 0; i < SCHEDULER_WHEEL_SLOTS; i++) {
+    slots[i] = NULL;
+  }
+}
+
+bool Scheduler::add(SchedulerTask &task) {
+  if (taskCount >= SCHEDULER_MAX_TASKS) {
+    return false;
+  }
+  tasks[taskCount++] = &task;
+  return true;
+}
+
+void Scheduler::start(SchedulerTask &task, unsigned long delayMs) {
+  if (!started) {
+    currentTick = millis();
+    started = true;
+  }
+  unlink(task);
+  task.active = true;
+  // Due no earlier than the next tick, the current one is already processed
+  task.due = millis() + max(delayMs, 1UL);
+  link(task);
+}
+
+void Scheduler::stop(SchedulerTask &task) {
+  task.active = false;
+  unlink(task);
+}
+
+void Scheduler::run() {
+  unsigned long now = millis();
+  if (!started) {
+    currentTick = now;
+    started = true;
+  }
+
+  // A long stall only needs one turn of the wheel, every task due in the
+  // skipped ticks is still in its slot and runs late
+  if (now - currentTick > SCHEDULER_WHEEL_SLOTS) {
+    currentTick = now - SCHEDULER_WHEEL_SLOTS;
+  }
+  while (currentTick != now) {
+    currentTick++;
+    runSlot(currentTick, now);
+  }
+
+  sleepUntilNextDue();
+}
+
+void Scheduler::runSlot(unsigned long tick, unsigned long now) {
+  SchedulerTask *task = slots[tick & SLOT_MASK];
+  while (task) {
+    SchedulerTask *following = task->next;
+    if (tickReached(task->due, tick)) {
+      unlink(*task);
+
+      // Lateness against the tick the task was due at
+      unsigned long lateness = now - task->due;
+      if (lateness > task->maxLateness) {
+        task->maxLateness = lateness;
+      }
+      if (lateness > task->deadline) {
+        task->misses++;
+      }
+      task->runs++;
+      task->function();
+
+      // Next run on the original phase, past any runs already missed. The
+      // function may have stopped or restarted the task itself.
+      if (task->active && !task->linked) {
+        do {
+          task->due += task->period;
+        } while (tickReached(task->due, now));
+        link(*task);
+      }
+
+      // The slot may have changed while the function ran, start over
+      following = slots[tick & SLOT_MASK];
+    }
+    task = following;
+  }
+}
+
+void Scheduler::sleepUntilNextDue() {
+  // Earliest due tick among the running tasks
+  bool any = false;
+  unsigned long nextDue = 0;
+  for (int i = 0; i < taskCount; i++) {
+    if (tasks[i]->active && (!any || tickReached(tasks[i]->due, nextDue))) {
+      nextDue = tasks[i]->due;
+      any = true;
+    }
+  }
+  if (!any) {
+    return;
+  }
+  while (!tickReached(nextDue, millis())) {
+    SCHEDULER_IDLE();
+  }
+}
+
+void Scheduler::link(SchedulerTask &task) {
+  SchedulerTask *&head = slots[task.due & SLOT_MASK];
+  task.next = head;
+  head = &task;
+  task.linked = true;
+}
+
+void Scheduler::unlink(SchedulerTask &task) {
+  if (!task.linked) {
+    return;
+  }
+  SchedulerTask **entry = &slots[task.due & SLOT_MASK];
+  while (*entry && *entry != &task) {
+    entry = &(*entry)->next;
+  }
+  if (*entry) {
+    *entry = task.next;
+  }
+  task.next = NULL;
+  task.linked = false;
+}
+
+void Scheduler::printStats(Print &out) const {
+  for (int i = 0; i < taskCount; i++) {
+    const SchedulerTask &task = *tasks[i];
+    out.print(task.name);
+    out.print(": ");
+    out.print(task.runs);
+    out.print(" runs, ");
+    out.print(task.misses);
+    out.print(" missed deadlines, worst lateness ");
+    out.print(task.maxLateness);
+    out.println(" ms");
+  }
+}
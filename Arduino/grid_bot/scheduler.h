@@ -0,0 +1,87 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+// Timer wheel slots, one per millisecond tick, a power of two. Tasks due
+// further ahead wait in their slot for later turns of the wheel.
+#ifndef SCHEDULER_WHEEL_SLOTS
+#define SCHEDULER_WHEEL_SLOTS 32
+#endif
+
+// Most tasks a scheduler can hold
+const int SCHEDULER_MAX_TASKS = 8;
+
+typedef void (*TaskFunction)();
+
+// Periodic task. A run that starts more than deadline milliseconds after it
+// was due counts as a missed deadline.
+class SchedulerTask {
+public:
+  SchedulerTask(const char *name, TaskFunction function, unsigned long periodMs, unsigned long deadlineMs);
+
+  bool isActive() const { return active; }
+
+  // Timing statistics since the task was added
+  unsigned long getRuns() const { return runs; }
+  unsigned long getMisses() const { return misses; }
+  unsigned long getMaxLateness() const { return maxLateness; }
+
+private:
+  friend class Scheduler;
+
+  const char *name;
+  TaskFunction function;
+  unsigned long period;
+  unsigned long deadline;
+
+  // Wheel state
+  unsigned long due;     // Tick of the next run
+  SchedulerTask *next;   // Next task in the same slot
+  bool active;           // Started and not stopped
+  bool linked;           // Currently in a wheel slot
+
+  unsigned long runs;
+  unsigned long misses;
+  unsigned long maxLateness;
+};
+
+// Cooperative fixed-rate scheduler on a hashed timer wheel. run() calls
+// every task that has come due, in tick order, then idles the CPU until the
+// next one is due. Periodic tasks keep their phase; runs missed while the
+// loop was blocked are skipped rather than replayed.
+class Scheduler {
+public:
+  Scheduler();
+
+  // Register a task, returns false when the scheduler is full
+  bool add(SchedulerTask &task);
+
+  // Start a task, first run after delayMs. Restarts a task already running.
+  void start(SchedulerTask &task, unsigned long delayMs = 0);
+
+  // Stop a task, safe to call from inside its own function
+  void stop(SchedulerTask &task);
+
+  // Run due tasks, then sleep until the next one
+  void run();
+
+  // Print runs, missed deadlines and worst lateness of each task
+  void printStats(Print &out) const;
+
+private:
+  static const unsigned long SLOT_MASK = SCHEDULER_WHEEL_SLOTS - 1;
+
+  SchedulerTask *slots[SCHEDULER_WHEEL_SLOTS];
+  SchedulerTask *tasks[SCHEDULER_MAX_TASKS];
+  int taskCount;
+  unsigned long currentTick;  // Last tick processed
+  bool started;
+
+  void link(SchedulerTask &task);
+  void unlink(SchedulerTask &task);
+  void runSlot(unsigned long tick, unsigned long now);
+  void sleepUntilNextDue();
+};
+
+#endif
@@ -1,4 +1,7 @@
 #include "settings_manager.h"
+#include "ui_text.h"
+
+UI_FORBID_STRING
 
 // Settings option mapping
 const SettingInfo SETTINGS_INFO[] = { 
@@ -81,10 +84,10 @@ const char* SettingsManager::getDriveDistanceLabel() const {
 }
 
 // Settings labels
-const String* SettingsManager::getSettingsLabels() {
-  static String labels[3];
-  for (int i = 0; i < 3; i++) {
-    labels[i] = String(SETTINGS_INFO[i].label);
+const char* const* SettingsManager::getSettingsLabels() {
+  static const char* labels[sizeof(SETTINGS_INFO) / sizeof(SETTINGS_INFO[0])];
+  for (int i = 0; i < getSettingsLabelsCount(); i++) {
+    labels[i] = SETTINGS_INFO[i].label;
   }
   return labels;
 }
@@ -61,7 +61,7 @@ public:
   const char* getDriveDistanceLabel() const;
   
   // Settings labels
-  static const String* getSettingsLabels();
+  static const char* const* getSettingsLabels();
   static int getSettingsLabelsCount();
   
   // Helper functions for robust mapping
@@ -0,0 +1,52 @@
+#include "touch_calibration.h"
+
+#if TOUCH_CALIBRATION_STORED
+#include <EEPROM.h>
+
+static uint32_t recordChecksum(const TouchCalibrationRecord &record) {
+  uint32_t sum = record.magic;
+  for (int i = 0; i < 6; i++) {
+    sum ^= (uint32_t)record.coeffs[i];
+  }
+  return sum;
+}
+#endif
+
+TouchCalibration::TouchCalibration() : xx(1L << 16), xy(0), x0(0), yx(0), yy(1L << 16), y0(0) {}
+
+void TouchCalibration::setRange(int minX, int maxX, int minY, int maxY, int width, int height) {
+  // Same result as map(raw, min, max, 0, size) on each axis
+  xx = ((int32_t)width << 16) / (maxX - minX);
+  xy = 0;
+  x0 = -xx * minX;
+  yx = 0;
+  yy = ((int32_t)height << 16) / (maxY - minY);
+  y0 = -yy * minY;
+}
+
+void TouchCalibration::setMatrix(const int32_t coeffs[6]) {
+  xx = coeffs[0];
+  xy = coeffs[1];
+  x0 = coeffs[2];
+  yx = coeffs[3];
+  yy = coeffs[4];
+  y0 = coeffs[5];
+}
+
+bool TouchCalibration::load() {
+#if TOUCH_CALIBRATION_STORED
+  // Byte by byte, which every EEPROM implementation provides
+  TouchCalibrationRecord record;
+  uint8_t *bytes = (uint8_t *)&record;
+  for (size_t i = 0; i < sizeof(record); i++) {
+    bytes[i] = EEPROM.read(TOUCH_CALIBRATION_ADDRESS + i);
+  }
+  if (record.magic != TOUCH_CALIBRATION_MAGIC || record.checksum != recordChecksum(record)) {
+    return false;
+  }
+  setMatrix(record.coeffs);
+  return true;
+#else
+  return false;
+#endif
+}
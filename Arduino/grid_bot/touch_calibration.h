@@ -0,0 +1,64 @@
+#ifndef TOUCH_CALIBRATION_H
+#define TOUCH_CALIBRATION_H
+
+#include <Arduino.h>
+
+// Whether load() reads the record stored by touch_calibration.ino. SAMD
+// boards only emulate EEPROM in the sketch's own flash, which uploading
+// grid_bot erases, so there nothing can be stored across the two sketches
+// and the matrix is compiled in with TOUCH_CALIBRATION_MATRIX instead.
+#ifndef TOUCH_CALIBRATION_STORED
+#if defined(ARDUINO_ARCH_SAMD)
+#define TOUCH_CALIBRATION_STORED 0
+#else
+#define TOUCH_CALIBRATION_STORED 1
+#endif
+#endif
+
+// Where the calibration record lives in EEPROM
+#ifndef TOUCH_CALIBRATION_ADDRESS
+#define TOUCH_CALIBRATION_ADDRESS 0
+#endif
+
+// Record written by the touch_calibration sketch. The layout must match
+// the copy in touch_calibration.ino.
+const uint32_t TOUCH_CALIBRATION_MAGIC = 0x54434131;  // "TCA1"
+
+struct TouchCalibrationRecord {
+  uint32_t magic;
+  int32_t coeffs[6];   // xx, xy, x0, yx, yy, y0 in 16.16 fixed point
+  uint32_t checksum;   // magic and coefficients XORed together
+};
+
+// Affine map from raw touch readings to screen pixels, which corrects
+// scale, offset, rotation and skew of the panel:
+//   x = xx * rawX + xy * rawY + x0
+//   y = yx * rawX + yy * rawY + y0
+// Coefficients are 16.16 fixed point, so a mapped touch costs four
+// multiplies and no divides.
+class TouchCalibration {
+public:
+  TouchCalibration();
+
+  // Axis aligned map from raw ranges to a width x height screen
+  void setRange(int minX, int maxX, int minY, int maxY, int width, int height);
+
+  // Use coefficients in the order printed by the calibration sketch
+  void setMatrix(const int32_t coeffs[6]);
+
+  // Load the stored record, returns false if none is stored or it is
+  // damaged, and always without TOUCH_CALIBRATION_STORED
+  bool load();
+
+  // Map a raw reading to screen pixels, rounded to the nearest pixel
+  void toScreen(int rawX, int rawY, int &x, int &y) const {
+    x = (int)((xx * rawX + xy * rawY + x0 + 0x8000) >> 16);
+    y = (int)((yx * rawX + yy * rawY + y0 + 0x8000) >> 16);
+  }
+
+private:
+  int32_t xx, xy, x0;
+  int32_t yx, yy, y0;
+};
+
+#endif
@@ -0,0 +1,163 @@
+#include "touch_input.h"
+
+// Median of three values
+static int16_t median3(int16_t a, int16_t b, int16_t c) {
+  if (a > b) {
+    int16_t t = a;
+    a = b;
+    b = t;
+  }
+  if (b > c) {
+    b = c;
+  }
+  return a > b ? a : b;
+}
+
+TouchInput::TouchInput() : pressureThreshold(10) {
+  reset();
+}
+
+void TouchInput::setPressureThreshold(int16_t threshold) {
+  pressureThreshold = threshold;
+}
+
+void TouchInput::reset() {
+  down = false;
+  pressedRun = 0;
+  releasedRun = 0;
+  historyCount = 0;
+  filteredX = 0;
+  filteredY = 0;
+  pressX = 0;
+  pressY = 0;
+  reportedX = 0;
+  reportedY = 0;
+  pressTime = 0;
+  moved = false;
+  longPressSent = false;
+  eventHead = 0;
+  eventCount = 0;
+}
+
+void TouchInput::addSample(const TouchSample &sample) {
+  if (sample.z > pressureThreshold) {
+    releasedRun = 0;
+    if (pressedRun < TOUCH_PRESS_SAMPLES) {
+      pressedRun++;
+    }
+    pushHistory(sample.x, sample.y);
+
+    if (!down) {
+      // Press edge once enough consecutive samples agree
+      if (pressedRun < TOUCH_PRESS_SAMPLES) {
+        return;
+      }
+      down = true;
+      moved = false;
+      longPressSent = false;
+      pressTime = sample.time;
+      updateFilter(true);
+      pressX = reportedX = positionX();
+      pressY = reportedY = positionY();
+      pushEvent(TOUCH_PRESS, pressX, pressY, sample.time);
+      return;
+    }
+
+    updateFilter(false);
+    int16_t x = positionX();
+    int16_t y = positionY();
+
+    // A finger that leaves the slop area is dragging, not tapping
+    if (!moved && (abs(x - pressX) > TOUCH_SLOP || abs(y - pressY) > TOUCH_SLOP)) {
+      moved = true;
+    }
+    if (abs(x - reportedX) >= TOUCH_MOVE_STEP || abs(y - reportedY) >= TOUCH_MOVE_STEP) {
+      reportedX = x;
+      reportedY = y;
+      pushEvent(TOUCH_MOVE, x, y, sample.time);
+    }
+    if (!moved && !longPressSent && sample.time - pressTime >= TOUCH_LONG_PRESS_MS) {
+      longPressSent = true;
+      pushEvent(TOUCH_LONG_PRESS, pressX, pressY, sample.time);
+    }
+    return;
+  }
+
+  // Not touching. Before a press the run of pressed samples starts over.
+  if (!down) {
+    pressedRun = 0;
+    historyCount = 0;
+    return;
+  }
+
+  // A press in progress ends after enough quiet samples. Until then the
+  // filter history is kept, so a dropout during a drag is bridged.
+  if (++releasedRun < TOUCH_RELEASE_SAMPLES) {
+    return;
+  }
+  down = false;
+  releasedRun = 0;
+  pressedRun = 0;
+  historyCount = 0;
+  if (!moved && !longPressSent) {
+    pushEvent(TOUCH_TAP, pressX, pressY, sample.time);
+  }
+  pushEvent(TOUCH_RELEASE, reportedX, reportedY, sample.time);
+}
+
+bool TouchInput::nextEvent(TouchEvent &event) {
+  if (eventCount == 0) {
+    return false;
+  }
+  event = events[eventHead];
+  eventHead = (eventHead + 1) % MAX_EVENTS;
+  eventCount--;
+  return true;
+}
+
+void TouchInput::pushHistory(int16_t x, int16_t y) {
+  // Oldest reading first
+  if (historyCount == 3) {
+    historyX[0] = historyX[1];
+    historyY[0] = historyY[1];
+    historyX[1] = historyX[2];
+    historyY[1] = historyY[2];
+    historyCount = 2;
+  }
+  historyX[historyCount] = x;
+  historyY[historyCount] = y;
+  historyCount++;
+}
+
+void TouchInput::updateFilter(bool first) {
+  // Median of the readings so far, the newest one until three are stored
+  int16_t x = historyX[historyCount - 1];
+  int16_t y = historyY[historyCount - 1];
+  if (historyCount == 3) {
+    x = median3(historyX[0], historyX[1], historyX[2]);
+    y = median3(historyY[0], historyY[1], historyY[2]);
+  }
+
+  // The press starts the filter at the reading, later samples are smoothed
+  if (first) {
+    filteredX = (long)x << 4;
+    filteredY = (long)y << 4;
+  } else {
+    filteredX += (((long)x << 4) - filteredX) >> TOUCH_IIR_SHIFT;
+    filteredY += (((long)y << 4) - filteredY) >> TOUCH_IIR_SHIFT;
+  }
+}
+
+void TouchInput::pushEvent(TouchEventType type, int16_t x, int16_t y, unsigned long time) {
+  // Full only if the reader fell behind, the oldest event is dropped
+  if (eventCount == MAX_EVENTS) {
+    eventHead = (eventHead + 1) % MAX_EVENTS;
+    eventCount--;
+  }
+  TouchEvent &event = events[(eventHead + eventCount) % MAX_EVENTS];
+  event.type = type;
+  event.x = x;
+  event.y = y;
+  event.time = time;
+  eventCount++;
+}
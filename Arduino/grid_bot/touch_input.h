@@ -0,0 +1,107 @@
+#ifndef TOUCH_INPUT_H
+#define TOUCH_INPUT_H
+
+#include <Arduino.h>
+#include "touch_sampler.h"
+
+// Consecutive samples above or below the pressure threshold needed before
+// a press or release is accepted. Bridges single-sample dropouts while a
+// finger is down and ignores single-sample spikes while it is not.
+#ifndef TOUCH_PRESS_SAMPLES
+#define TOUCH_PRESS_SAMPLES 3
+#endif
+#ifndef TOUCH_RELEASE_SAMPLES
+#define TOUCH_RELEASE_SAMPLES 3
+#endif
+
+// Smoothing of the median filtered position, each sample moves the output
+// 1/2^TOUCH_IIR_SHIFT of the way towards the new reading
+#ifndef TOUCH_IIR_SHIFT
+#define TOUCH_IIR_SHIFT 1
+#endif
+
+// Raw units the position must change by before a move is reported
+const int TOUCH_MOVE_STEP = 3;
+
+// Raw units a finger may wander and still tap or long press, about half a cell
+const int TOUCH_SLOP = 12;
+
+// Hold time for a long press
+const unsigned long TOUCH_LONG_PRESS_MS = 800;
+
+enum TouchEventType {
+  TOUCH_PRESS,       // Finger down, at the first filtered position
+  TOUCH_MOVE,        // Finger moved while down
+  TOUCH_LONG_PRESS,  // Held in place for TOUCH_LONG_PRESS_MS
+  TOUCH_TAP,         // Lifted in place before a long press, at the press position
+  TOUCH_RELEASE      // Finger up, after any tap
+};
+
+// Gesture event in raw touch panel units
+struct TouchEvent {
+  TouchEventType type;
+  int16_t x;
+  int16_t y;
+  unsigned long time;  // Time of the sample that produced the event
+};
+
+// Turns raw samples into gesture events. Pressure qualified samples pass
+// through a 3-sample median, which removes the spikes resistive panels give
+// near the edges of a press, then a first order IIR filter.
+class TouchInput {
+public:
+  TouchInput();
+
+  // Samples with a pressure above this count as touching
+  void setPressureThreshold(int16_t threshold);
+
+  // Forget any touch in progress
+  void reset();
+
+  // Feed the next sample, events it produces are read with nextEvent()
+  void addSample(const TouchSample &sample);
+
+  // Pop the oldest pending event, returns false when there is none
+  bool nextEvent(TouchEvent &event);
+
+private:
+  static const int MAX_EVENTS = 4;
+
+  int16_t pressureThreshold;
+
+  // Press and release qualification
+  bool down;
+  uint8_t pressedRun;
+  uint8_t releasedRun;
+
+  // Last three pressed readings for the median
+  int16_t historyX[3];
+  int16_t historyY[3];
+  uint8_t historyCount;
+
+  // Filtered position in 1/16 raw units
+  long filteredX;
+  long filteredY;
+
+  // Gesture tracking
+  int16_t pressX;
+  int16_t pressY;
+  int16_t reportedX;
+  int16_t reportedY;
+  unsigned long pressTime;
+  bool moved;
+  bool longPressSent;
+
+  // Pending events
+  TouchEvent events[MAX_EVENTS];
+  uint8_t eventHead;
+  uint8_t eventCount;
+
+  void pushHistory(int16_t x, int16_t y);
+  void updateFilter(bool first);
+  void pushEvent(TouchEventType type, int16_t x, int16_t y, unsigned long time);
+  int16_t positionX() const { return (int16_t)(filteredX >> 4); }
+  int16_t positionY() const { return (int16_t)(filteredY >> 4); }
+};
+
+#endif
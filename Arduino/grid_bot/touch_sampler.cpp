@@ -0,0 +1,52 @@
+#include "touch_sampler.h"
+
+static_assert((TOUCH_SAMPLE_CAPACITY & (TOUCH_SAMPLE_CAPACITY - 1)) == 0 && TOUCH_SAMPLE_CAPACITY <= 128,
+              "TOUCH_SAMPLE_CAPACITY must be a power of two no larger than 128");
+
+TouchSampler::TouchSampler()
+  : screen(NULL), head(0), tail(0), overruns(0) {}
+
+void TouchSampler::begin(TouchScreen &ts) {
+  screen = &ts;
+  head = 0;
+  tail = 0;
+  overruns = 0;
+}
+
+void TouchSampler::sample() {
+  if (!screen) {
+    return;
+  }
+
+  // The touch pins are not shared with the display, so reading them cannot
+  // disturb a background transfer
+  TSPoint p = screen->getPoint();
+
+  uint8_t next = (head + 1) & MASK;
+  if (next == tail) {
+    // Full, keep the older samples so press and release order is preserved
+    overruns++;
+    return;
+  }
+  TouchSample &slot = samples[head];
+  slot.x = p.x;
+  slot.y = p.y;
+  slot.z = p.z;
+  slot.time = millis();
+  head = next;
+}
+
+bool TouchSampler::read(TouchSample &sample) {
+  if (tail == head) {
+    return false;
+  }
+  sample = samples[tail];
+  tail = (tail + 1) & MASK;
+  return true;
+}
+
+unsigned int TouchSampler::takeOverruns() {
+  unsigned int count = overruns;
+  overruns = 0;
+  return count;
+}
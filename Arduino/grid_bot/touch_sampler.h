@@ -0,0 +1,58 @@
+#ifndef TOUCH_SAMPLER_H
+#define TOUCH_SAMPLER_H
+
+#include <Arduino.h>
+#include "TouchScreen.h"
+
+// Touch sampling rate in Hz
+#ifndef TOUCH_SAMPLE_RATE_HZ
+#define TOUCH_SAMPLE_RATE_HZ 200
+#endif
+
+// Samples held between drains, a power of two. At 200 Hz the default covers
+// 160 ms of loop time.
+#ifndef TOUCH_SAMPLE_CAPACITY
+#define TOUCH_SAMPLE_CAPACITY 32
+#endif
+
+// Raw touch reading with the time it was taken
+struct TouchSample {
+  int16_t x;
+  int16_t y;
+  int16_t z;               // Pressure, 0 when nothing touches the panel
+  unsigned long time;      // millis() at the sample
+};
+
+// Queues touch panel readings taken at a fixed rate for a slower consumer.
+// A reading switches the panel pins and runs several blocking analogRead
+// conversions, so it is taken from a scheduler task at TOUCH_SAMPLE_RATE_HZ
+// rather than from an interrupt. The render task draws in slices of
+// UI_FLUSH_SLICE_MICROS, so the task is held off by at most one slice, and
+// the ring buffer lets event handling run less often without losing samples.
+class TouchSampler {
+public:
+  TouchSampler();
+
+  // Start sampling ts, clearing any queued samples
+  void begin(TouchScreen &ts);
+
+  // Take one reading, called at TOUCH_SAMPLE_RATE_HZ
+  void sample();
+
+  // Pop the oldest sample, returns false when the buffer is empty
+  bool read(TouchSample &sample);
+
+  // Samples lost because the buffer was full, cleared on read
+  unsigned int takeOverruns();
+
+private:
+  static const uint8_t MASK = TOUCH_SAMPLE_CAPACITY - 1;
+
+  TouchScreen *screen;
+  TouchSample samples[TOUCH_SAMPLE_CAPACITY];
+  uint8_t head;           // Next slot to write
+  uint8_t tail;           // Next slot to read
+  unsigned int overruns;
+};
+
+#endif
@@ -0,0 +1,641 @@
+#include "ui_controller.h"
+
+UI_FORBID_STRING
+
+// Grid model instance
+GridModel gridModel;
+
+// Settings manager instance
+SettingsManager settingsManager;
+
+// UI elements
+UIIconButton undoButton;
+UIIconButton redoButton;
+UITextButton startButton;
+UIIconButton optimizeButton;
+UIIconButton settingsButton;
+UISettingsMenu settingsMenu;
+UIGrid uiGrid;
+
+// Touch targets, registered by initUI()
+UIHitMap hitMap;
+
+// Screen parts changed by handlers and tasks. Only the render task draws
+// them, so touch handling and motion control never wait on the display.
+const uint8_t REDRAW_START_BUTTON = 1 << 0;
+const uint8_t REDRAW_SETTINGS_MENU = 1 << 1;  // Whole menu, after opening it, in slices
+const uint8_t REDRAW_UNDER_MENU = 1 << 2;     // Grid the closed menu covered
+uint8_t pendingRedraws = 0;
+uint8_t pendingOptions = 0;  // Settings options to redraw, one bit each
+
+// Set current state
+UIState uiState = IDLE;
+
+// Set current state
+DriveState driveState = STOPPED;
+
+// Countdown before a run, and the seconds still shown on the start button
+const int countdownDuration = 5000;
+int countdownRemaining = 0;
+
+// Movement timing constants
+const unsigned long FORWARD_MOVE_TIME = 2000;  // Time to move forward one cell
+const unsigned long TURN_MOVE_TIME = 2000;     // Time to execute a 90-degree turn
+
+// Compiled motion plan for the current run
+MotionPlan motionPlan;
+
+// Route planner used by the optimize action
+PathPlanner pathPlanner;
+
+// Current movement tracking
+unsigned long moveStartTime;  // Start time of current movement
+int currentSegment = 0;       // Index of the segment being executed
+int segmentCellsDone = 0;     // Cells reached within the current straight segment
+
+// Drag tracking, set while a finger that pressed the path end stays down
+bool isDragging = false;
+
+// Task scheduler, loop() only runs it
+Scheduler scheduler;
+
+// Tasks with their periods and deadlines in milliseconds
+SchedulerTask motionTask("Motion", executeMovement, 5, 5);        // Runs only while driving
+SchedulerTask renderTask("Render", runRenderTask, 20, 40);        // Grid flush slices
+SchedulerTask countdownTask("Countdown", runCountdownTask, 1000, 50);  // One tick per second shown
+
+void addUITasks() {
+  // Rendering runs from the start, the others when a run is started
+  scheduler.add(motionTask);
+  scheduler.add(renderTask);
+  scheduler.add(countdownTask);
+  scheduler.start(renderTask);
+}
+
+void initGridModel(){
+  // Calculate grid size to fit in screen
+  int availableHeight = tft.height() - BUTTON_HEIGHT - BUTTON_MARGIN - 1;
+  int availableWidth = tft.width() - 1;
+  int numRows = availableHeight / CELL_SIZE;
+  int numCols = (availableWidth / CELL_SIZE) - ((availableWidth / CELL_SIZE) % 2 == 0 ? 1 : 0);
+  
+  // Initialize grid model
+  gridModel.initGrid(numRows, numCols);
+
+  // Report static model, planner and motion plan memory use
+  GridModel::printMemoryReport(Serial);
+  PathPlanner::printMemoryReport(Serial);
+  MotionPlan::printMemoryReport(Serial);
+}
+
+void initUI() {
+  // Set UI grid size
+  uiGrid.setSize(gridModel.getNumRows(), gridModel.getNumCols());
+
+  // Set grid bounds
+  int gridWidth = gridModel.getNumCols() * CELL_SIZE;
+  int gridHeight = gridModel.getNumRows() * CELL_SIZE;
+  int gridX = (tft.width() - (gridWidth + 1)) / 2;
+  int totalGroupHeight = gridHeight + BUTTON_MARGIN + BUTTON_HEIGHT + 1;
+  int gridY = (tft.height() - totalGroupHeight) / 2;
+  uiGrid.setBounds(gridX, gridY, gridWidth, gridHeight);
+
+  // Button row y position
+  int y = gridY + gridHeight + BUTTON_MARGIN + 1;
+
+  // Set undo button bounds and icon
+  undoButton.setBounds(gridX, y, UNDO_BUTTON_WIDTH, BUTTON_HEIGHT);
+  undoButton.setIcon(UNDO_ICON);
+
+  // Set redo button bounds and icon
+  int redoX = undoButton.x + undoButton.width + BUTTON_MARGIN;
+  redoButton.setBounds(redoX, y, REDO_BUTTON_WIDTH, BUTTON_HEIGHT);
+  redoButton.setIcon(REDO_ICON);
+
+  // Set start button bounds and width
+  int startButtonWidth = gridWidth - UNDO_BUTTON_WIDTH - BUTTON_MARGIN -
+                      REDO_BUTTON_WIDTH - BUTTON_MARGIN -
+                      OPTIMIZE_BUTTON_WIDTH - BUTTON_MARGIN -
+                      SETTINGS_BUTTON_WIDTH - BUTTON_MARGIN + 1;
+  int startX = redoButton.x + redoButton.width + BUTTON_MARGIN;
+  startButton.setBounds(startX, y, startButtonWidth, BUTTON_HEIGHT);
+  
+  // Update start button text and color
+  updateStartButton();
+
+  // Set optimize button bounds and icon
+  int optimizeX = startButton.x + startButton.width + BUTTON_MARGIN;
+  optimizeButton.setBounds(optimizeX, y, OPTIMIZE_BUTTON_WIDTH, BUTTON_HEIGHT);
+  optimizeButton.setIcon(OPTIMIZE_ICON);
+
+  // Set settings button bounds and icon
+  int settingsX = optimizeButton.x + optimizeButton.width + BUTTON_MARGIN;
+  settingsButton.setBounds(settingsX, y, SETTINGS_BUTTON_WIDTH, BUTTON_HEIGHT);
+  settingsButton.setIcon(SETTINGS_ICON);
+
+  // Set settings menu options
+  settingsMenu.setupOptions(SettingsManager::getSettingsLabels(), SettingsManager::getSettingsLabelsCount());
+  char brightnessText[UI_TEXT_CAPACITY];
+  formatPercent(brightnessText, sizeof(brightnessText), settingsManager.getDisplayBrightness());
+  settingsMenu.updateOptionValue(BRIGHTNESS, brightnessText);
+  settingsMenu.updateOptionValue(DRIVE_SPEED, settingsManager.getDriveSpeedLabel());
+  settingsMenu.updateOptionValue(DRIVE_DISTANCE, settingsManager.getDriveDistanceLabel());
+
+  // Set settings menu bounds
+  int menuWidth = gridWidth * 0.85;
+  int menuHeight = 225;
+  int menuX = gridX + (gridWidth - menuWidth) / 2;
+  int menuY = gridY + (gridHeight - menuHeight) / 2;
+  settingsMenu.setPosition(menuX, menuY, menuWidth, menuHeight);
+
+  // Set settings options positions
+  settingsMenu.layout();
+
+  // Register touch targets for the new layout
+  initHitMap();
+}
+
+void initHitMap() {
+  // Events each target responds to
+  const uint8_t press = 1 << TOUCH_PRESS;
+  const uint8_t move = 1 << TOUCH_MOVE;
+  const uint8_t tap = 1 << TOUCH_TAP;
+  const uint8_t longPress = 1 << TOUCH_LONG_PRESS;
+
+  // States each target is active in
+  const uint8_t idle = UI_STATE_BIT(IDLE);
+  const uint8_t settings = UI_STATE_BIT(SETTINGS);
+  const uint8_t notSettings = UI_ALL_STATES & ~settings;
+
+  hitMap.clear();
+  bool added = true;
+
+  // Buttons act on taps, holding undo clears the whole path
+  added &= hitMap.add(startButton.x, startButton.y, startButton.width, startButton.height, notSettings, tap, onTouchStartButton);
+  added &= hitMap.add(undoButton.x, undoButton.y, undoButton.width, undoButton.height, idle, tap, onTouchUndoButton);
+  added &= hitMap.add(undoButton.x, undoButton.y, undoButton.width, undoButton.height, idle, longPress, onLongPressUndoButton);
+  added &= hitMap.add(redoButton.x, redoButton.y, redoButton.width, redoButton.height, idle, tap, onTouchRedoButton);
+  added &= hitMap.add(optimizeButton.x, optimizeButton.y, optimizeButton.width, optimizeButton.height, idle, tap, onTouchOptimizeButton);
+  added &= hitMap.add(settingsButton.x, settingsButton.y, settingsButton.width, settingsButton.height, UI_ALL_STATES, tap, onTouchSettingsButton);
+
+  // Grid cells are added as soon as the finger lands so a drag can follow
+  added &= hitMap.addCells(uiGrid.x, uiGrid.y, CELL_SIZE, CELL_SIZE, uiGrid.numRows, uiGrid.numCols, idle, press, onTouchGrid);
+  added &= hitMap.addCells(uiGrid.x, uiGrid.y, CELL_SIZE, CELL_SIZE, uiGrid.numRows, uiGrid.numCols, idle, move, onDragGrid);
+
+  // Settings arrows while the menu is open
+  added &= settingsMenu.addHitRegions(hitMap, settings, tap, onTouchSettingsLeftArrow, onTouchSettingsRightArrow);
+
+  // A target that did not fit would silently ignore touches
+  if (!added) {
+    Serial.println("Touch targets exceed UI_HIT_MAX_REGIONS, some will not respond");
+  }
+}
+
+void drawUI() {
+  // Draw all UI elements
+#ifdef UI_DRAW_STATS
+  resetDrawStats();
+#endif
+  uiGrid.redrawAll(tft, gridModel, uiState);
+#ifdef UI_DRAW_STATS
+  printDrawStats(Serial, UI_BATCHED_DRAW ? "Grid draw (batched)" : "Grid draw (unbatched)");
+#endif
+  undoButton.draw(tft);
+  redoButton.draw(tft);
+  startButton.draw(tft);
+  optimizeButton.draw(tft);
+  settingsButton.draw(tft);
+}
+
+void updateStartButton(int countdownNumber) {
+  // Button properties
+  uint16_t currentColor;
+  char buttonText[UI_TEXT_CAPACITY];
+  
+  // Define properties based on current state
+  switch (uiState) {
+    case COUNTING:
+      currentColor = BUTTON_COUNTING_COLOR;
+      formatInt(buttonText, sizeof(buttonText), countdownNumber);
+      break;
+    case RUNNING:
+      currentColor = BUTTON_RUNNING_COLOR;
+      copyText(buttonText, sizeof(buttonText), "Stop");
+      break;
+    case COMPLETE:
+      currentColor = BUTTON_COMPLETE_COLOR;
+      copyText(buttonText, sizeof(buttonText), "Done!");
+      break;
+    case IDLE:
+    default:
+      currentColor = BUTTON_IDLE_COLOR;
+      copyText(buttonText, sizeof(buttonText), "Start");
+      break;
+  }
+  
+  // Set button text and color
+  startButton.setLabel(buttonText);
+  startButton.setBgColor(currentColor);
+}
+
+void startNextSegment() {
+  // Check if every segment in the plan has been executed
+  if (currentSegment >= motionPlan.getSegmentCount()) {
+    // Path is complete, stop all movement
+    // Here you would stop motors:
+    // stopMotors();
+    Serial.println("Path complete");
+    scheduler.stop(motionTask);
+    scheduler.printStats(Serial);
+    // Update UI to show completion state
+    uiState = COMPLETE;
+    driveState = STOPPED;
+    updateStartButton();
+    pendingRedraws |= REDRAW_START_BUTTON;
+    return;
+  }
+
+  // Begin the next segment
+  const MotionSegment &segment = motionPlan.getSegment(currentSegment);
+  if (segment.type == SEGMENT_TURN) {
+    // Transition to turning state
+    driveState = TURNING;
+    // Here you would add actual motor control:
+    // if (segment.turn < 0) turnLeft();
+    // if (segment.turn > 0) turnRight();
+    Serial.print("Turning ");
+    Serial.println(segment.turn < 0 ? "left" : (segment.turn == 2 ? "around" : "right"));
+  } else {
+    // Transition to driving state
+    driveState = DRIVING;
+    segmentCellsDone = 0;
+    // Here you would add actual motor control:
+    // driveForward();
+    Serial.print("Driving ");
+    Serial.print(segment.cells);
+    Serial.println(" cells");
+  }
+  // Record the start time for movement timing
+  moveStartTime = millis();
+}
+
+void executeMovement() {
+  // Movement state machine that steps through the compiled motion plan
+  switch (driveState) {
+
+    // Handle stopped state - start the next segment
+    case STOPPED:
+      startNextSegment();
+      break;
+
+    // Handle driving state - advance along a straight run
+    case DRIVING:
+      {
+        const MotionSegment &segment = motionPlan.getSegment(currentSegment);
+        unsigned long elapsed = millis() - moveStartTime;
+
+        // Mark each cell reached so far in this run as processed
+        int cellsReached = min((unsigned long)segment.cells, elapsed / FORWARD_MOVE_TIME);
+        if (segmentCellsDone < cellsReached) {
+          gridModel.setCurrentPathIndex(gridModel.getCurrentPathIndex() + cellsReached - segmentCellsDone);
+          segmentCellsDone = cellsReached;
+        }
+
+        // Move on once the whole run has been driven
+        if (elapsed >= segment.duration) {
+          currentSegment += 1;
+          startNextSegment();
+        }
+        break;
+      }
+
+    // Handle turning state - execute the turn
+    case TURNING:
+      {
+        const MotionSegment &segment = motionPlan.getSegment(currentSegment);
+        // Check if turn duration has elapsed
+        if (millis() - moveStartTime >= segment.duration) {
+          // Update bot's current direction and start the next segment
+          gridModel.setCurrentDirection(static_cast<Direction>(segment.heading));
+          // Here you would update motor control:
+          // stopTurning();
+          Serial.println("Turn complete");
+          currentSegment += 1;
+          startNextSegment();
+        }
+        break;
+      }
+  }
+}
+
+void runCountdownTask() {
+  // Show the next number until the countdown runs out
+  countdownRemaining -= 1;
+  if (countdownRemaining > 0) {
+    updateStartButton(countdownRemaining);
+    pendingRedraws |= REDRAW_START_BUTTON;
+    return;
+  }
+  scheduler.stop(countdownTask);
+
+  // Initialize path execution
+  gridModel.setCurrentPathIndex(0);
+  gridModel.setCurrentDirection(UP);
+
+  // Compile the path into straight runs and turns. A plan that does not fit
+  // would stop short of the path end, so the run is not started.
+  if (!motionPlan.compile(gridModel, UP, FORWARD_MOVE_TIME, TURN_MOVE_TIME)) {
+    Serial.println("Path too long for the motion plan, run cancelled");
+    motionPlan.clear();
+    uiState = IDLE;
+    updateStartButton();
+    pendingRedraws |= REDRAW_START_BUTTON;
+    markStateCellsDirty();
+    return;
+  }
+
+  // Change state to running
+  uiState = RUNNING;
+  currentSegment = 0;
+  driveState = STOPPED;
+  Serial.print("Planned run time: ");
+  Serial.print(motionPlan.getTotalDuration() / 1000);
+  Serial.println(" s");
+
+  // Update start button
+  updateStartButton();
+  pendingRedraws |= REDRAW_START_BUTTON;
+
+  // Motion control runs until the path is complete or the run is stopped
+  scheduler.start(motionTask);
+}
+
+// Part of this run's slice budget left, at least 1 so every slice makes
+// progress, since a budget of 0 means no limit
+static unsigned long renderBudgetLeft(unsigned long start) {
+  unsigned long used = micros() - start;
+  if (UI_FLUSH_SLICE_MICROS == 0) {
+    return 0;
+  }
+  return used < UI_FLUSH_SLICE_MICROS ? UI_FLUSH_SLICE_MICROS - used : 1;
+}
+
+void runRenderTask() {
+  // Every path below draws in slices of UI_FLUSH_SLICE_MICROS in total, so
+  // the sample task runs between them and no touch is missed
+  unsigned long start = micros();
+
+  // Widgets changed since the last run, after any background grid transfer
+  if (pendingRedraws != 0 || pendingOptions != 0) {
+    uiGrid.finishTransfer(tft);
+  }
+  if (pendingRedraws & REDRAW_START_BUTTON) {
+    startButton.update(tft);
+    pendingRedraws &= ~REDRAW_START_BUTTON;
+  }
+  if (pendingRedraws & REDRAW_SETTINGS_MENU) {
+    // Finish pending grid drawing so it cannot land on top of the menu, then
+    // draw the menu. Either may take several runs.
+    if (uiGrid.flushSlice(tft, gridModel, uiState, renderBudgetLeft(start)) ||
+        settingsMenu.drawSlice(tft, renderBudgetLeft(start))) {
+      return;
+    }
+    pendingRedraws &= ~REDRAW_SETTINGS_MENU;
+  }
+  if (pendingRedraws & REDRAW_UNDER_MENU) {
+    // The cells are left dirty for the flush below
+    uiGrid.restoreRegion(tft, gridModel, settingsMenu.x, settingsMenu.y, settingsMenu.width, settingsMenu.height);
+    pendingRedraws &= ~REDRAW_UNDER_MENU;
+  }
+  for (int i = 0; pendingOptions != 0; i++, pendingOptions >>= 1) {
+    if (pendingOptions & 1) {
+      settingsMenu.redrawOption(i, tft);
+    }
+  }
+
+  // Redraw changed cells within what is left of the budget so motion and
+  // touch tasks never wait on a full repaint. The grid is hidden in settings.
+  if (uiState != SETTINGS) {
+    uiGrid.flushSlice(tft, gridModel, uiState, renderBudgetLeft(start));
+  }
+}
+
+void handleTouch(TouchEventType type, int pixelX, int pixelY) {
+  // A lifted finger ends any drag
+  if (type == TOUCH_RELEASE) {
+    isDragging = false;
+    return;
+  }
+
+  // Pass the event to the target under the touch
+  hitMap.dispatch(pixelX, pixelY, uiState, 1 << type);
+}
+
+void onTouchStartButton(const UIHit &) {
+  Serial.println("Start button toucheddd");
+
+  // Handle start button touch in different states
+  switch (uiState) {
+    case IDLE:
+      // Change state to counting and start the countdown
+      uiState = COUNTING;
+      countdownRemaining = countdownDuration / 1000;
+      scheduler.start(countdownTask, 1000);
+
+      // Update button text
+      updateStartButton(countdownRemaining);
+      pendingRedraws |= REDRAW_START_BUTTON;
+      break;
+
+    case COUNTING:
+      // Fallthrough to next case
+
+    case RUNNING:
+      // Fallthrough to next case
+
+    case COMPLETE:
+      // Change state to idle, stop the countdown or run and reset drive state
+      uiState = IDLE;
+      scheduler.stop(countdownTask);
+      scheduler.stop(motionTask);
+      driveState = STOPPED;
+
+      // Update start button
+      updateStartButton();
+      pendingRedraws |= REDRAW_START_BUTTON;
+      break;
+
+    case SETTINGS:
+      // Not a touch target while the menu is open
+      return;
+  }
+
+  // Cells whose colour depends on the state are redrawn by the next flush
+  markStateCellsDirty();
+}
+
+void markStateCellsDirty() {
+  // Processed cells and selectable neighbours of the last cell depend on UI state
+  gridModel.markPathDirty(0, gridModel.getCurrentPathIndex());
+  PathCell last = gridModel.getPathCell(gridModel.getPathLength() - 1);
+  gridModel.markCellAndNeighborsDirty(last.row, last.col);
+}
+
+void onTouchUndoButton(const UIHit &) {
+  Serial.println("Undo button touched");
+
+  // Remove the last path cell, the cells it affected are redrawn by the next flush
+  gridModel.pathPop();
+}
+
+void onLongPressUndoButton(const UIHit &) {
+  Serial.println("Undo button long pressed");
+
+  // Reset grid values and default path
+  gridModel.resetGridValues();
+  gridModel.resetDefaultPath();
+}
+
+void onTouchRedoButton(const UIHit &) {
+  Serial.println("Redo button touched");
+
+  // Put back the last undone cell, the cells it affected are redrawn by the next flush
+  gridModel.pathRedo();
+}
+
+void onTouchOptimizeButton(const UIHit &) {
+  Serial.println("Optimize button touched");
+
+  // Estimate run time of the drawn path
+  const PackedPath &path = gridModel.getPath();
+  unsigned long before = MotionPlan::estimateDuration(path, UP, FORWARD_MOVE_TIME, TURN_MOVE_TIME);
+
+  // Search for the fastest route between the same end points
+  if (!pathPlanner.findRoute(gridModel, path.first(), UP, path.last(), false,
+                             FORWARD_MOVE_TIME, TURN_MOVE_TIME)) {
+    Serial.println("No route found");
+    return;
+  }
+  unsigned long after = pathPlanner.getRouteCost();
+
+  // Report before and after estimates
+  Serial.print("Estimated run time: ");
+  Serial.print(before / 1000.0, 1);
+  Serial.print(" s -> ");
+  Serial.print(after / 1000.0, 1);
+  Serial.println(" s");
+
+  // Replace the path only if the new route is faster
+  if (after < before) {
+    gridModel.setPath(pathPlanner.getRoute());
+    Serial.print("Saved ");
+    Serial.print((before - after) / 1000.0, 1);
+    Serial.println(" s");
+  } else {
+    Serial.println("Path is already optimal");
+  }
+}
+
+void onTouchSettingsButton(const UIHit &) {
+  Serial.println("Settings button touched");
+
+  // In idle state, change to settings state and have the menu drawn. When
+  // it was closed before the grid under it was repainted, the parts drawn
+  // so far are still on screen and drawing carries on after them.
+  if (uiState == IDLE) {
+    uiState = SETTINGS;
+    if (!(pendingRedraws & REDRAW_UNDER_MENU)) {
+      settingsMenu.beginDraw();
+    }
+    pendingRedraws = (pendingRedraws & ~REDRAW_UNDER_MENU) | REDRAW_SETTINGS_MENU;
+  } 
+  // In settings state, change to idle state and have the grid under the
+  // menu repainted, unless no part of the menu was drawn yet
+  else if (uiState == SETTINGS) {
+    uiState = IDLE;
+    pendingOptions = 0;
+    pendingRedraws &= ~REDRAW_SETTINGS_MENU;
+    if (settingsMenu.isDrawStarted()) {
+      pendingRedraws |= REDRAW_UNDER_MENU;
+    }
+  }
+}
+
+void onTouchGrid(const UIHit &hit) {
+  Serial.println("Grid touched");
+
+  // Check if cell is selectable
+  if (gridModel.isSelectable(hit.row, hit.col)) {
+    // Add path cell to model
+    gridModel.pathAdd(hit.row, hit.col);
+  }
+
+  // Only a press on the path end, or on the cell it just added, starts a
+  // drag. Moving off any other cell must not fill a route to it.
+  PathCell last = gridModel.getPathCell(gridModel.getPathLength() - 1);
+  isDragging = last.row == hit.row && last.col == hit.col;
+}
+
+void onDragGrid(const UIHit &hit) {
+  int gridRow = hit.row;
+  int gridCol = hit.col;
+
+  // Only a drag that started on the path end extends the path
+  if (!isDragging) {
+    return;
+  }
+
+  // Ignore samples on cells already in the path
+  if (gridModel.getGridValue(gridRow, gridCol)) {
+    return;
+  }
+
+  if (gridModel.isSelectable(gridRow, gridCol)) {
+    // Adjacent cell, add it directly
+    gridModel.pathAdd(gridRow, gridCol);
+  } else {
+    // Fill the gap with a shortest route through free cells
+    PathCell last = gridModel.getPathCell(gridModel.getPathLength() - 1);
+    PathCell target = { (GridCoord)gridRow, (GridCoord)gridCol };
+    if (!pathPlanner.findRoute(gridModel, last, UP, target, true, 1, 0)) {
+      return;
+    }
+    const PackedPath &route = pathPlanner.getRoute();
+    for (int i = 1; i < route.length(); i++) {
+      PathCell cell = route.cellAt(i);
+      gridModel.pathAdd(cell.row, cell.col);
+    }
+  }
+}
+
+void onTouchSettingsLeftArrow(const UIHit &hit) {
+  handleSettingsArrow(static_cast<SettingOption>(hit.arg), -1);
+}
+
+void onTouchSettingsRightArrow(const UIHit &hit) {
+  handleSettingsArrow(static_cast<SettingOption>(hit.arg), 1);
+}
+
+void handleSettingsArrow(SettingOption option, int direction) {
+  // Update the setting option value in the manager
+  settingsManager.adjustSetting(option, direction);
+  char valueText[UI_TEXT_CAPACITY];
+
+  // Update value in settings menu, the render task redraws it
+  switch (option) {
+    case BRIGHTNESS:
+      setBrightness();
+      formatPercent(valueText, sizeof(valueText), settingsManager.getDisplayBrightness());
+      settingsMenu.updateOptionValue(BRIGHTNESS, valueText);
+      pendingOptions |= 1 << BRIGHTNESS;
+      break;
+    case DRIVE_SPEED:
+      settingsMenu.updateOptionValue(DRIVE_SPEED, settingsManager.getDriveSpeedLabel());
+      pendingOptions |= 1 << DRIVE_SPEED;
+      break;
+    case DRIVE_DISTANCE:
+      settingsMenu.updateOptionValue(DRIVE_DISTANCE, settingsManager.getDriveDistanceLabel());
+      pendingOptions |= 1 << DRIVE_DISTANCE;
+      break;
+  }
+}
@@ -0,0 +1,81 @@
+#ifndef UI_CONTROLLER_H
+#define UI_CONTROLLER_H
+
+// Screen layout, touch handlers and the run they start. The sketch and the
+// host tests both compile this file, so the tests replay the real handlers
+// and tasks against the host framebuffer.
+
+#include <Arduino.h>
+#include "display.h"
+#include "ui_elements.h"
+#include "grid_model.h"
+#include "settings_manager.h"
+#include "motion_plan.h"
+#include "path_planner.h"
+#include "scheduler.h"
+#include "state.h"
+#include "touch_input.h"
+
+// Provided by grid_bot.ino, or by the host program
+extern Display tft;
+void setBrightness();  // Apply the brightness setting to the backlight
+
+// Model and UI elements
+extern GridModel gridModel;
+extern SettingsManager settingsManager;
+extern UIIconButton undoButton;
+extern UIIconButton redoButton;
+extern UITextButton startButton;
+extern UIIconButton optimizeButton;
+extern UIIconButton settingsButton;
+extern UISettingsMenu settingsMenu;
+extern UIGrid uiGrid;
+extern UIHitMap hitMap;
+
+// Screen parts waiting for the render task, see ui_controller.cpp
+extern uint8_t pendingRedraws;
+extern uint8_t pendingOptions;
+
+// Current UI and drive state
+extern UIState uiState;
+extern DriveState driveState;
+
+// Task scheduler, and the tasks added by addUITasks()
+extern Scheduler scheduler;
+extern SchedulerTask motionTask;
+extern SchedulerTask renderTask;
+extern SchedulerTask countdownTask;
+
+// Setup, in this order once the display is running
+void initGridModel();  // Grid size to fit the screen
+void initUI();         // Layout and touch targets
+void drawUI();         // Full repaint
+void addUITasks();     // Register the motion, render and countdown tasks
+
+// Deliver a touch event at screen pixel coordinates
+void handleTouch(TouchEventType type, int pixelX, int pixelY);
+
+// Layout and drawing helpers
+void initHitMap();
+void updateStartButton(int countdownNumber = -1);
+void markStateCellsDirty();
+
+// Tasks
+void executeMovement();
+void runRenderTask();
+void runCountdownTask();
+
+// Touch targets registered by initHitMap()
+void onTouchStartButton(const UIHit &hit);
+void onTouchUndoButton(const UIHit &hit);
+void onLongPressUndoButton(const UIHit &hit);
+void onTouchRedoButton(const UIHit &hit);
+void onTouchOptimizeButton(const UIHit &hit);
+void onTouchSettingsButton(const UIHit &hit);
+void onTouchGrid(const UIHit &hit);
+void onDragGrid(const UIHit &hit);
+void onTouchSettingsLeftArrow(const UIHit &hit);
+void onTouchSettingsRightArrow(const UIHit &hit);
+void handleSettingsArrow(SettingOption option, int direction);
+
+#endif
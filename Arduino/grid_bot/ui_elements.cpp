@@ -1,34 +1,331 @@
 #include "ui_elements.h"
 #include "grid_model.h"
+#include "icons.h"
+
+UI_FORBID_STRING
+
+// Batched drawing helpers (private to this file). With UI_BATCHED_DRAW the grid
+// is drawn inside one SPI transaction per frame using the write* primitives,
+// otherwise every primitive opens its own transaction as the plain calls do.
+namespace {
+void countTransaction() {
+#ifdef UI_DRAW_STATS
+    uiDrawStats.transactions++;
+#endif
+}
+
+void countWindow(long pixels) {
+#ifdef UI_DRAW_STATS
+    uiDrawStats.addressWindows++;
+    uiDrawStats.pixels += pixels;
+#else
+    (void)pixels;
+#endif
+}
+
+void beginBatch(Display &tft) {
+#if UI_BATCHED_DRAW
+    tft.startWrite();
+    countTransaction();
+#else
+    (void)tft;
+#endif
+}
+
+void endBatch(Display &tft) {
+#if UI_BATCHED_DRAW
+    tft.endWrite();
+#else
+    (void)tft;
+#endif
+}
+
+void batchFillRect(Display &tft, int rx, int ry, int w, int h, uint16_t color) {
+#if UI_BATCHED_DRAW
+    tft.writeFillRect(rx, ry, w, h, color);
+#else
+    tft.fillRect(rx, ry, w, h, color);
+    countTransaction();
+#endif
+    countWindow((long)w * h);
+}
+
+void batchHLine(Display &tft, int lx, int ly, int w, uint16_t color) {
+#if UI_BATCHED_DRAW
+    tft.writeFastHLine(lx, ly, w, color);
+#else
+    tft.drawFastHLine(lx, ly, w, color);
+    countTransaction();
+#endif
+    countWindow(w);
+}
+
+void batchVLine(Display &tft, int lx, int ly, int h, uint16_t color) {
+#if UI_BATCHED_DRAW
+    tft.writeFastVLine(lx, ly, h, color);
+#else
+    tft.drawFastVLine(lx, ly, h, color);
+    countTransaction();
+#endif
+    countWindow(h);
+}
+
+// Fill a square cell interior with a glyph mask centred on the background,
+// sent as one address window and a burst of colour runs
+void batchBlitGlyph(Display &tft, int cx, int cy, int size, uint16_t bg, uint16_t fg, int glyph) {
+#if !UI_BATCHED_DRAW
+    tft.startWrite();
+    countTransaction();
+#endif
+    tft.setAddrWindow(cx, cy, size, size);
+
+    // Walk the pixel stream, runs of one colour continue across rows
+    int glyphStart = (size - PATH_GLYPH_SIZE) / 2;
+    uint16_t runColor = bg;
+    uint32_t runLength = 0;
+    for (int r = 0; r < size; r++) {
+        int glyphRow = r - glyphStart;
+        if (glyphRow < 0 || glyphRow >= PATH_GLYPH_SIZE) {
+            // Row without glyph pixels
+            if (runColor != bg) {
+                tft.writeColor(runColor, runLength);
+                runColor = bg;
+                runLength = 0;
+            }
+            runLength += size;
+            continue;
+        }
+        uint8_t bits = pgm_read_byte(&PATH_GLYPHS[glyph][glyphRow]);
+        for (int c = 0; c < size; c++) {
+            int glyphCol = c - glyphStart;
+            bool set = glyphCol >= 0 && glyphCol < PATH_GLYPH_SIZE &&
+                       ((bits >> (PATH_GLYPH_SIZE - 1 - glyphCol)) & 1);
+            uint16_t color = set ? fg : bg;
+            if (color != runColor) {
+                tft.writeColor(runColor, runLength);
+                runColor = color;
+                runLength = 0;
+            }
+            runLength++;
+        }
+    }
+    tft.writeColor(runColor, runLength);
+
+#if !UI_BATCHED_DRAW
+    tft.endWrite();
+#endif
+    countWindow((long)size * size);
+}
+
+// Decode a compressed icon (see icons.h) straight into one address window,
+// sending every run as a single colour burst without a pixel buffer
+void blitCompressedIcon(Display &tft, int ix, int iy, const uint8_t *icon) {
+    int w = pgm_read_byte(icon + ICON_WIDTH_OFFSET);
+    int h = pgm_read_byte(icon + ICON_HEIGHT_OFFSET);
+    uint8_t format = pgm_read_byte(icon + ICON_FORMAT_OFFSET);
+    const uint8_t *palette = icon + ICON_HEADER_SIZE;
+    const uint8_t *data = palette + 2 * pgm_read_byte(icon + ICON_PALETTE_OFFSET);
+
+    tft.startWrite();
+    countTransaction();
+    tft.setAddrWindow(ix, iy, w, h);
+    long remaining = (long)w * h;
+    while (remaining > 0) {
+        long count;
+        uint16_t color;
+        if (format == ICON_RLE565) {
+            count = pgm_read_byte(data);
+            color = pgm_read_byte(data + 1) | (pgm_read_byte(data + 2) << 8);
+            data += 3;
+        } else {
+            uint8_t index;
+            if (format == ICON_PAL4) {
+                count = (pgm_read_byte(data) >> 4) + 1;
+                index = pgm_read_byte(data) & 0x0F;
+                data += 1;
+            } else {
+                count = pgm_read_byte(data);
+                index = pgm_read_byte(data + 1);
+                data += 2;
+            }
+            color = pgm_read_byte(palette + 2 * index) | (pgm_read_byte(palette + 2 * index + 1) << 8);
+        }
+        if (count == 0 || count > remaining) {
+            count = remaining;  // Never write past the window on bad data
+        }
+        tft.writeColor(color, count);
+        remaining -= count;
+    }
+    tft.endWrite();
+    countWindow((long)w * h);
+}
+
+// Part of a fill inside an open transaction, skipped when empty
+void fillPart(Display &tft, int rx, int ry, int w, int h, uint16_t color) {
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    tft.writeFillRect(rx, ry, w, h, color);
+    countWindow((long)w * h);
+}
+
+// Fill a rectangle except for an inner rectangle, which the caller paints itself
+void fillAround(Display &tft, int rx, int ry, int rw, int rh,
+                int ix, int iy, int iw, int ih, uint16_t color) {
+    tft.startWrite();
+    countTransaction();
+    fillPart(tft, rx, ry, rw, iy - ry, color);                 // Above
+    fillPart(tft, rx, iy + ih, rw, ry + rh - iy - ih, color);  // Below
+    fillPart(tft, rx, iy, ix - rx, ih, color);                 // Left
+    fillPart(tft, ix + iw, iy, rx + rw - ix - iw, ih, color);  // Right
+    tft.endWrite();
+}
+
+// Offscreen target that captures one classic font glyph as a 6x8 bit mask,
+// so the library font can be streamed without a pixel buffer
+class GlyphMask : public Adafruit_GFX {
+public:
+    uint8_t rows[FONT_CHAR_HEIGHT];  // Bit 0 is the leftmost column
+
+    GlyphMask() : Adafruit_GFX(FONT_CHAR_WIDTH, FONT_CHAR_HEIGHT) {}
+
+    void load(char c) {
+        memset(rows, 0, sizeof(rows));
+        drawChar(0, 0, c, 1, 0, 1);
+    }
+
+    void drawPixel(int16_t px, int16_t py, uint16_t color) override {
+        if (px < 0 || px >= FONT_CHAR_WIDTH || py < 0 || py >= FONT_CHAR_HEIGHT) {
+            return;
+        }
+        if (color) {
+            rows[py] |= 1 << px;
+        } else {
+            rows[py] &= ~(1 << px);
+        }
+    }
+};
+
+// Paint one character cell, background and foreground together, as a single
+// address window and a burst of colour runs. Must be called inside startWrite.
+void blitTextGlyph(Display &tft, int gx, int gy, char c, uint8_t size, uint16_t fg, uint16_t bg) {
+    static GlyphMask mask;
+    mask.load(c);
+
+    int w = FONT_CHAR_WIDTH * size;
+    int h = FONT_CHAR_HEIGHT * size;
+    tft.setAddrWindow(gx, gy, w, h);
+    uint16_t runColor = bg;
+    uint32_t runLength = 0;
+    for (int r = 0; r < h; r++) {
+        uint8_t bits = mask.rows[r / size];
+        for (int col = 0; col < w; col++) {
+            uint16_t color = ((bits >> (col / size)) & 1) ? fg : bg;
+            if (color != runColor) {
+                tft.writeColor(runColor, runLength);
+                runColor = color;
+                runLength = 0;
+            }
+            runLength++;
+        }
+    }
+    tft.writeColor(runColor, runLength);
+    countWindow((long)w * h);
+}
+}
+
+// --- UIGlyphText implementation ---
+UIGlyphText::UIGlyphText() : drawnX(0), drawnY(0), drawnSize(0), drawnFg(0), drawnBg(0), valid(false) {
+    drawn[0] = '\0';
+}
+
+void UIGlyphText::draw(Display &tft, int tx, int ty, const char *text,
+                       uint8_t size, uint16_t fg, uint16_t bg) {
+    // Old glyphs only carry over when they sit on the same baseline in the same style
+    bool reuse = valid && ty == drawnY && size == drawnSize && fg == drawnFg && bg == drawnBg;
+    int cellWidth = FONT_CHAR_WIDTH * size;
+    int cellHeight = FONT_CHAR_HEIGHT * size;
+    int oldLength = reuse ? strlen(drawn) : 0;
+    int newLength = strlen(text);
+
+    tft.startWrite();
+    countTransaction();
+    for (int i = 0; i < newLength; i++) {
+        int cx = tx + i * cellWidth;
+        int offset = cx - drawnX;
+        if (reuse && offset >= 0 && offset % cellWidth == 0 &&
+            offset / cellWidth < oldLength && drawn[offset / cellWidth] == text[i]) {
+            continue;  // Same glyph already on screen
+        }
+        blitTextGlyph(tft, cx, ty, text[i], size, fg, bg);
+    }
+
+    // Clear whatever the previous text covered outside the new one
+    if (reuse) {
+        int oldStart = drawnX;
+        int oldEnd = drawnX + oldLength * cellWidth;
+        int newStart = tx;
+        int newEnd = tx + newLength * cellWidth;
+        if (newLength == 0) {
+            newStart = newEnd = oldEnd;
+        }
+        fillPart(tft, oldStart, ty, min(oldEnd, newStart) - oldStart, cellHeight, bg);
+        int rightStart = max(oldStart, newEnd);
+        fillPart(tft, rightStart, ty, oldEnd - rightStart, cellHeight, bg);
+    }
+    tft.endWrite();
+
+    copyText(drawn, sizeof(drawn), text);
+    drawnX = tx;
+    drawnY = ty;
+    drawnSize = size;
+    drawnFg = fg;
+    drawnBg = bg;
+    valid = true;
+}
 
 // This helper is still useful for subclasses
-void UIButton::draw(Adafruit_ILI9341 &tft) const {
+void UIButton::draw(Display &tft) const {
   tft.fillRect(x, y, width, height, bgColor);
 }
 
-// Implementation is moved here. It now uses member variables.
-void UITextButton::draw(Adafruit_ILI9341 &tft) const {
-  UIButton::draw(tft); // Draw the background first!
+// Paints the background around the label and the label glyphs in one pass,
+// so no pixel is written twice
+void UITextButton::draw(Display &tft) const {
+  int textX, textY;
+  textOrigin(textX, textY);
+  int textWidth = strlen(label) * FONT_CHAR_WIDTH * textSize;
+  int textHeight = FONT_CHAR_HEIGHT * textSize;
+  fillAround(tft, x, y, width, height, textX, textY, textWidth, textHeight, bgColor);
+  text.invalidate();
+  text.draw(tft, textX, textY, label, textSize, textColor, bgColor);
+}
 
-  tft.setTextColor(textColor);
-  tft.setTextSize(textSize);
-  int charWidth = FONT_CHAR_WIDTH * textSize;
-  int textWidth = label.length() * charWidth;
-  int textX = x + (width - textWidth) / 2;
-  int textY = y + (height - (FONT_CHAR_HEIGHT * textSize)) / 2;
-  tft.setCursor(textX, textY);
-  tft.print(label);
+void UITextButton::update(Display &tft) const {
+  if (!text.isDrawnOn(bgColor)) {
+    draw(tft);  // Background changed, repaint the whole button
+    return;
+  }
+  int textX, textY;
+  textOrigin(textX, textY);
+  text.draw(tft, textX, textY, label, textSize, textColor, bgColor);
 }
 
-void UIIconButton::draw(Adafruit_ILI9341 &tft) const {
+void UITextButton::textOrigin(int &textX, int &textY) const {
+  int textWidth = strlen(label) * FONT_CHAR_WIDTH * textSize;
+  textX = x + (width - textWidth) / 2;
+  textY = y + (height - (FONT_CHAR_HEIGHT * textSize)) / 2;
+}
+
+void UIIconButton::draw(Display &tft) const {
   UIButton::draw(tft);
 
   int iconX = x + (width - iconWidth) / 2;
   int iconY = y + (height - iconHeight) / 2;
-  tft.drawRGBBitmap(iconX, iconY, icon, iconWidth, iconHeight);
+  blitCompressedIcon(tft, iconX, iconY, icon);
 }
 
-void UIArrow::draw(Adafruit_ILI9341 &tft) const {
+void UIArrow::draw(Display &tft) const {
   // Draw the background first
   UIButton::draw(tft);
 
@@ -51,23 +348,30 @@ void UIArrow::draw(Adafruit_ILI9341 &tft) const {
   }
 }
 
-void UISettingsValue::draw(Adafruit_ILI9341 &tft) const {
-    // Clear the entire value area using calculated height
+void UISettingsValue::draw(Display &tft) const {
+    // Paint the value area around the text, then the glyphs with their background
     int textHeight = FONT_CHAR_HEIGHT * textSize;
-    tft.fillRect(x, y, width, textHeight, backgroundColor);
+    int textX = textOriginX();
+    int textWidth = strlen(value) * FONT_CHAR_WIDTH * textSize;
+    fillAround(tft, x, y, width, textHeight, textX, y, textWidth, textHeight, backgroundColor);
+    text.invalidate();
+    text.draw(tft, textX, y, value, textSize, textColor, backgroundColor);
+}
 
-    // Set text properties
-    tft.setTextSize(textSize);
-    tft.setTextColor(textColor);
-    
-    // Calculate centered position for text using FONT_CHAR_WIDTH
+void UISettingsValue::update(Display &tft) const {
+    if (!text.isDrawnOn(backgroundColor)) {
+        draw(tft);
+        return;
+    }
+    text.draw(tft, textOriginX(), y, value, textSize, textColor, backgroundColor);
+}
+
+int UISettingsValue::textOriginX() const {
+    // Centre the text, ignoring the blank column after the last glyph
     int fontPadding = textSize;
     int scaledCharWidth = FONT_CHAR_WIDTH * textSize;
-    int actualTextWidth = value.length() * scaledCharWidth - fontPadding;
-    int textX = x + (width - actualTextWidth) / 2;
-    
-    tft.setCursor(textX, y);
-    tft.print(value);
+    int actualTextWidth = strlen(value) * scaledCharWidth - fontPadding;
+    return x + (width - actualTextWidth) / 2;
 }
 
 void UISettingsOption::layout() {
@@ -76,7 +380,7 @@ void UISettingsOption::layout() {
     int fontPadding = textSize;
     
     // Calculate label position (centered)
-    int labelWidth = label.length() * charWidth - fontPadding;
+    int labelWidth = strlen(label) * charWidth - fontPadding;
     labelX = x + (width - labelWidth) / 2;
     labelY = y;
     
@@ -108,7 +412,7 @@ void UISettingsOption::layout() {
     value.setTextSize(textSize);
 }
 
-void UISettingsOption::draw(Adafruit_ILI9341 &tft) const {
+void UISettingsOption::draw(Display &tft) const {
     // Set text properties for label
     tft.setTextSize(textSize);
     tft.setTextColor(textColor);
@@ -138,63 +442,87 @@ void UISettingsMenu::layout() {
     }
 }
 
-void UISettingsMenu::draw(Adafruit_ILI9341 &tft) const {
-    // Draw menu background
-    tft.fillRect(x, y, width, height, backgroundColor);
-    tft.drawRect(x, y, width, height, borderColor);
-    
-    // Draw all options
-    for (int i = 0; i < numOptions; i++) {
-        options[i].draw(tft);
+void UISettingsMenu::draw(Display &tft) const {
+    for (int part = 0; part < partCount(); part++) {
+        drawPart(tft, part);
     }
 }
 
-int UISettingsMenu::optionIndexContaining(int px, int py) const {
-    for (int i = 0; i < numOptions; i++) {
-        if (px >= options[i].x && px <= options[i].x + options[i].width &&
-            py >= options[i].y && py <= options[i].y + options[i].height) {
-            return i;
+bool UISettingsMenu::drawSlice(Display &tft, unsigned long budgetMicros) {
+    unsigned long start = micros();
+    while (nextPart < partCount()) {
+        drawPart(tft, nextPart++);
+        if (budgetMicros > 0 && micros() - start >= budgetMicros) {
+            break;
         }
     }
-    return -1;
+    return nextPart < partCount();
 }
 
-void UISettingsMenu::setupOptions(const String* labels, int count) {
-    numOptions = min(count, MAX_OPTIONS);
-    for (int i = 0; i < numOptions; i++) {
-        options[i].setLabel(labels[i]);
+int UISettingsMenu::partCount() const {
+    int bands = (height + SETTINGS_DRAW_BAND_LINES - 1) / SETTINGS_DRAW_BAND_LINES;
+    return bands + 1 + numOptions;
+}
+
+void UISettingsMenu::drawPart(Display &tft, int part) const {
+    // Draw menu background
+    int bands = (height + SETTINGS_DRAW_BAND_LINES - 1) / SETTINGS_DRAW_BAND_LINES;
+    if (part < bands) {
+        int top = part * SETTINGS_DRAW_BAND_LINES;
+        tft.fillRect(x, y + top, width, min(SETTINGS_DRAW_BAND_LINES, height - top), backgroundColor);
+        return;
+    }
+    part -= bands;
+    if (part == 0) {
+        tft.drawRect(x, y, width, height, borderColor);
+        return;
     }
+
+    // Draw one option
+    options[part - 1].draw(tft);
 }
 
-void UISettingsMenu::updateOptionValue(int optionIndex, const String& value) {
-    if (optionIndex >= 0 && optionIndex < numOptions) {
-        options[optionIndex].setValue(value);
+bool UISettingsMenu::addHitRegions(UIHitMap &map, uint8_t states, uint8_t events,
+                                   UIHitHandler onLeftArrow, UIHitHandler onRightArrow) const {
+    for (int i = 0; i < numOptions; i++) {
+        const UIArrow &left = options[i].leftArrow;
+        const UIArrow &right = options[i].rightArrow;
+        if (!map.add(left.x, left.y, left.width, left.height, states, events, onLeftArrow, i) ||
+            !map.add(right.x, right.y, right.width, right.height, states, events, onRightArrow, i)) {
+            return false;
+        }
     }
+    return true;
 }
 
-void UISettingsMenu::redrawOption(int optionIndex, Adafruit_ILI9341 &tft) const {
-    if (optionIndex >= 0 && optionIndex < numOptions) {
-        options[optionIndex].draw(tft);
+void UISettingsMenu::setupOptions(const char* const* labels, int count) {
+    numOptions = min(count, MAX_OPTIONS);
+    for (int i = 0; i < numOptions; i++) {
+        options[i].setLabel(labels[i]);
     }
 }
 
-// Implementation of arrow hit-testing helpers for UISettingsMenu
-bool UISettingsMenu::leftArrowContains(int px, int py, int optionIndex) const {
+void UISettingsMenu::updateOptionValue(int optionIndex, const char* value) {
     if (optionIndex >= 0 && optionIndex < numOptions) {
-        return options[optionIndex].leftArrow.contains(px, py);
+        options[optionIndex].setValue(value);
     }
-    return false;
 }
 
-bool UISettingsMenu::rightArrowContains(int px, int py, int optionIndex) const {
+void UISettingsMenu::redrawOption(int optionIndex, Display &tft) const {
+    // Only the value changes while the menu is open
     if (optionIndex >= 0 && optionIndex < numOptions) {
-        return options[optionIndex].rightArrow.contains(px, py);
+        options[optionIndex].value.update(tft);
     }
-    return false;
 }
 
 // --- UIGrid implementation ---
-UIGrid::UIGrid() : x(0), y(0), width(0), height(0), numRows(0), numCols(0) {}
+UIGrid::UIGrid() : x(0), y(0), width(0), height(0), numRows(0), numCols(0) {
+#if UI_STRIP_LINES
+    nextStrip = 0;
+    passActive = false;
+    transferPending = false;
+#endif
+}
 
 void UIGrid::setSize(int rows, int cols) {
     numRows = rows;
@@ -208,109 +536,310 @@ void UIGrid::setBounds(int bx, int by, int w, int h) {
     height = h;
 }
 
-void UIGrid::drawGridLines(Adafruit_ILI9341 &tft) {
-    for (int i = 0; i < numRows + 1; i++) {
-        tft.drawLine(
-            x,
-            i * CELL_SIZE + y,
-            x + width,
-            i * CELL_SIZE + y,
-            GRID_LINE_COLOR);
-    }
-    for (int i = 0; i < numCols + 1; i++) {
-        tft.drawLine(
-            i * CELL_SIZE + x,
-            y,
-            i * CELL_SIZE + x,
-            y + height,
-            GRID_LINE_COLOR);
-    }
+#ifdef UI_DRAW_STATS
+UIDrawStats uiDrawStats = { 0, 0, 0 };
+
+void resetDrawStats() {
+    uiDrawStats.transactions = 0;
+    uiDrawStats.addressWindows = 0;
+    uiDrawStats.pixels = 0;
 }
 
-// Helper for drawing cell direction (private to this file)
-namespace {
-void drawCellDirection(Adafruit_ILI9341 &tft, GridModel &model, int gridX, int gridY, int row, int col, int nextRow, int nextCol, uint16_t arrowColor) {
-    int centerX = col * CELL_SIZE + gridX + (CELL_SIZE / 2);
-    int centerY = row * CELL_SIZE + gridY + (CELL_SIZE / 2);
-    PathCell lastPathCell = model.getPathCell(model.getPathLength() - 1);
-    if (row == lastPathCell.row && col == lastPathCell.col) {
-        int circleRadius = 3;
-        tft.fillCircle(centerX, centerY, circleRadius, arrowColor);
-        return;
+void printDrawStats(Print &out, const char *label) {
+    out.print(label);
+    out.print(": transactions ");
+    out.print(uiDrawStats.transactions);
+    out.print(", windows ");
+    out.print(uiDrawStats.addressWindows);
+    out.print(", pixels ");
+    out.println(uiDrawStats.pixels);
+}
+#endif
+
+void UIGrid::drawGridLines(Display &tft) {
+    beginBatch(tft);
+    for (int i = 0; i < numRows + 1; i++) {
+        batchHLine(tft, x, i * CELL_SIZE + y, width + 1, GRID_LINE_COLOR);
     }
-    int dx = nextCol - col;
-    int dy = nextRow - row;
-    if (dx > 0) {
-        tft.fillTriangle(centerX - 3, centerY - 3, centerX - 3, centerY + 3, centerX + 3, centerY, arrowColor);
-    } else if (dx < 0) {
-        tft.fillTriangle(centerX + 3, centerY - 3, centerX + 3, centerY + 3, centerX - 3, centerY, arrowColor);
-    } else if (dy > 0) {
-        tft.fillTriangle(centerX - 3, centerY - 3, centerX + 3, centerY - 3, centerX, centerY + 3, arrowColor);
-    } else if (dy < 0) {
-        tft.fillTriangle(centerX - 3, centerY + 3, centerX + 3, centerY + 3, centerX, centerY - 3, arrowColor);
+    for (int i = 0; i < numCols + 1; i++) {
+        batchVLine(tft, i * CELL_SIZE + x, y, height + 1, GRID_LINE_COLOR);
     }
-}
+    endBatch(tft);
 }
 
-void UIGrid::drawGridCells(Adafruit_ILI9341 &tft, GridModel &model, UIState state) {
+void UIGrid::drawGridCells(Display &tft, GridModel &model, UIState state) {
     drawGridCells(tft, model, state, 0, model.getNumRows() - 1, 0, model.getNumCols() - 1);
 }
 
-void UIGrid::drawGridCells(Adafruit_ILI9341 &tft, GridModel &model, UIState state, int startRow, int endRow, int startCol, int endCol) {
+void UIGrid::drawGridCells(Display &tft, GridModel &model, UIState state, int startRow, int endRow, int startCol, int endCol) {
     // Clamp values to grid bounds
     startRow = max(0, min(startRow, model.getNumRows() - 1));
     endRow = max(0, min(endRow, model.getNumRows() - 1));
     startCol = max(0, min(startCol, model.getNumCols() - 1));
     endCol = max(0, min(endCol, model.getNumCols() - 1));
 
+    beginBatch(tft);
     for (int i = startRow; i <= endRow; i++) {
         for (int j = startCol; j <= endCol; j++) {
-            int color;
-            if (model.isCellActivated(i, j)) {
-                if (state == RUNNING || state == COMPLETE) {
-                    bool isProcessed = false;
-                    for (int p = 0; p <= model.getCurrentPathIndex(); p++) {
-                        PathCell pathCell = model.getPathCell(p);
-                        if (i == pathCell.row && j == pathCell.col) {
-                            isProcessed = true;
-                            break;
-                        }
-                    }
-                    if (isProcessed) {
-                        color = GRID_SELECTABLE_COLOR;
-                    } else {
-                        color = GRID_SELECTED_COLOR;
-                    }
-                } else {
-                    color = GRID_SELECTED_COLOR;
-                }
-            } else if (state == IDLE && model.isSelectable(i, j)) {
-                color = GRID_SELECTABLE_COLOR;
-            } else {
-                color = GRID_EMPTY_COLOR;
+            drawCell(tft, model, state, i, j);
+        }
+    }
+    endBatch(tft);
+}
+
+void UIGrid::flush(Display &tft, GridModel &model, UIState state) {
+    while (flushSlice(tft, model, state, 0)) {
+    }
+}
+
+bool UIGrid::flushSlice(Display &tft, GridModel &model, UIState state, unsigned long budgetMicros) {
+#if UI_STRIP_LINES
+    return flushCompositedSlice(tft, model, state, budgetMicros);
+#else
+    // Nothing to send, skip the transaction
+    if (!model.hasDirtyCells()) {
+        return false;
+    }
+
+    // Cells are cleared as they are drawn, so a slice that runs out of time
+    // resumes with whatever is still dirty, including cells marked meanwhile
+    unsigned long start = micros();
+    beginBatch(tft);
+    for (int i = 0; i < model.getNumRows(); i++) {
+        for (int j = 0; j < model.getNumCols(); j++) {
+            if (!model.isCellDirty(i, j)) {
+                continue;
             }
-            tft.fillRect(
-                j * CELL_SIZE + x + 1,
-                i * CELL_SIZE + y + 1,
-                CELL_SIZE - 1,
-                CELL_SIZE - 1,
-                color);
-            for (int p = 0; p < model.getPathLength(); p++) {
-                PathCell pathCell = model.getPathCell(p);
-                if (i == pathCell.row && j == pathCell.col) {
-                    if (model.getPathLength() == 1) {
-                        drawCellDirection(tft, model, x, y, pathCell.row, pathCell.col, pathCell.row - 1, pathCell.col, GRID_ARROW_COLOR);
-                    } else if (p == model.getPathLength() - 1) {
-                        drawCellDirection(tft, model, x, y, pathCell.row, pathCell.col, pathCell.row, pathCell.col, GRID_ARROW_COLOR);
-                    } else {
-                        PathCell nextPathCell = model.getPathCell(p + 1);
-                        drawCellDirection(tft, model, x, y, pathCell.row, pathCell.col, nextPathCell.row, nextPathCell.col, GRID_ARROW_COLOR);
-                    }
+
+            // Only the interior is filled, the grid lines are never touched
+            drawCell(tft, model, state, i, j);
+            model.clearCellDirty(i, j);
+
+            if (budgetMicros > 0 && micros() - start >= budgetMicros) {
+                endBatch(tft);
+                return model.hasDirtyCells();
+            }
+        }
+    }
+    endBatch(tft);
+    model.clearDirty();
+    return false;
+#endif
+}
+
+void UIGrid::finishTransfer(Display &tft) {
+#if UI_STRIP_LINES
+    if (transferPending) {
+        tft.dmaWait();
+        tft.endWrite();
+        transferPending = false;
+    }
+#else
+    (void)tft;
+#endif
+}
+
+void UIGrid::restoreRegion(Display &tft, GridModel &model, int rx, int ry, int rw, int rh) {
+    // Lines are drawn now, the cells are left dirty for the next flush
+
+    // Clip the region to the grid, overlays are placed inside it
+    int left = max(rx, x);
+    int top = max(ry, y);
+    int right = min(rx + rw - 1, x + numCols * CELL_SIZE);
+    int bottom = min(ry + rh - 1, y + numRows * CELL_SIZE);
+    if (left > right || top > bottom) {
+        return;
+    }
+
+    // Grid lines crossing the region, cut to its extent. Composited strips
+    // carry their own lines.
+#if !UI_STRIP_LINES
+    beginBatch(tft);
+    for (int i = (top - y + CELL_SIZE - 1) / CELL_SIZE; i * CELL_SIZE + y <= bottom; i++) {
+        batchHLine(tft, left, i * CELL_SIZE + y, right - left + 1, GRID_LINE_COLOR);
+    }
+    for (int i = (left - x + CELL_SIZE - 1) / CELL_SIZE; i * CELL_SIZE + x <= right; i++) {
+        batchVLine(tft, i * CELL_SIZE + x, top, bottom - top + 1, GRID_LINE_COLOR);
+    }
+    endBatch(tft);
+#else
+    (void)tft;
+#endif
+
+    // Cells overlapping the region, redrawn from the model. The settings menu
+    // covers most of the grid, so this is nearly every cell; the buttons and
+    // lines outside the region are left alone.
+    int lastRow = min((bottom - y) / CELL_SIZE, model.getNumRows() - 1);
+    int lastCol = min((right - x) / CELL_SIZE, model.getNumCols() - 1);
+    for (int i = (top - y) / CELL_SIZE; i <= lastRow; i++) {
+        for (int j = (left - x) / CELL_SIZE; j <= lastCol; j++) {
+            model.markCellDirty(i, j);
+        }
+    }
+}
+
+void UIGrid::redrawAll(Display &tft, GridModel &model, UIState state) {
+#if !UI_STRIP_LINES
+    drawGridLines(tft);
+#endif
+    model.markAllDirty();
+    flush(tft, model, state);
+}
+
+#if UI_STRIP_LINES
+namespace {
+const int STRIP_MAX_WIDTH = GRID_MAX_COLS * CELL_SIZE + 1;
+uint16_t stripBuffer[STRIP_MAX_WIDTH * UI_STRIP_LINES];
+}
+
+bool UIGrid::flushCompositedSlice(Display &tft, GridModel &model, UIState state, unsigned long budgetMicros) {
+#if defined(USE_SPI_DMA)
+    (void)budgetMicros;
+#else
+    unsigned long start = micros();
+#endif
+    finishTransfer(tft);
+
+    // Start a pass by snapshotting the dirty strips. Cells marked from here
+    // on are picked up by the next pass.
+    int stripWidth = numCols * CELL_SIZE + 1;
+    int gridLines = numRows * CELL_SIZE + 1;
+    if (!passActive) {
+        if (!model.hasDirtyCells()) {
+            return false;
+        }
+        memset(pendingStrips, 0, sizeof(pendingStrips));
+        for (int s = 0; s * UI_STRIP_LINES < gridLines; s++) {
+            if (isStripDirty(model, s * UI_STRIP_LINES, min(UI_STRIP_LINES, gridLines - s * UI_STRIP_LINES))) {
+                pendingStrips[s / 8] |= 1 << (s % 8);
+            }
+        }
+        model.clearDirty();
+        nextStrip = 0;
+        passActive = true;
+    }
+
+    // Every pending strip is rendered in full and sent in one write
+    for (; nextStrip * UI_STRIP_LINES < gridLines; nextStrip++) {
+        if (!(pendingStrips[nextStrip / 8] & (1 << (nextStrip % 8)))) {
+            continue;
+        }
+        int top = nextStrip * UI_STRIP_LINES;
+        int lines = min(UI_STRIP_LINES, gridLines - top);
+        composeStrip(model, state, top, lines, stripWidth);
+        tft.startWrite();
+        countTransaction();
+        tft.setAddrWindow(x, y + top, stripWidth, lines);
+        countWindow((long)stripWidth * lines);
+#if defined(USE_SPI_DMA)
+        // The buffer stays busy until the transfer ends, finish it next slice
+        tft.writePixels(stripBuffer, (uint32_t)stripWidth * lines, false);
+        transferPending = true;
+        nextStrip++;
+        return true;
+#else
+        tft.writePixels(stripBuffer, (uint32_t)stripWidth * lines);
+        tft.endWrite();
+        if (budgetMicros > 0 && micros() - start >= budgetMicros) {
+            nextStrip++;
+            return true;
+        }
+#endif
+    }
+    passActive = false;
+    return model.hasDirtyCells();
+}
+
+bool UIGrid::isStripDirty(GridModel &model, int top, int lines) {
+    int firstRow = max(0, (top - 1) / CELL_SIZE);
+    int lastRow = min(numRows - 1, (top + lines - 1) / CELL_SIZE);
+    for (int i = firstRow; i <= lastRow; i++) {
+        for (int j = 0; j < numCols; j++) {
+            if (model.isCellDirty(i, j)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void UIGrid::composeStrip(GridModel &model, UIState state, int top, int lines, int stripWidth) {
+    // Start from the line colour, then paint cell interiors over it
+    int pixels = stripWidth * lines;
+    for (int i = 0; i < pixels; i++) {
+        stripBuffer[i] = GRID_LINE_COLOR;
+    }
+
+    int size = CELL_SIZE - 1;
+    int glyphStart = (size - PATH_GLYPH_SIZE) / 2;
+    int firstRow = max(0, (top - 1) / CELL_SIZE);
+    int lastRow = min(numRows - 1, (top + lines - 1) / CELL_SIZE);
+    for (int i = firstRow; i <= lastRow; i++) {
+        int cellTop = i * CELL_SIZE + 1;
+        int from = max(cellTop, top);
+        int to = min(cellTop + size, top + lines);
+        for (int j = 0; j < numCols; j++) {
+            uint16_t color = cellColor(model, state, i, j);
+            int glyph = cellGlyph(model, i, j);
+            for (int py = from; py < to; py++) {
+                uint16_t *out = stripBuffer + (py - top) * stripWidth + j * CELL_SIZE + 1;
+                int glyphRow = py - cellTop - glyphStart;
+                uint8_t bits = 0;
+                if (glyph >= 0 && glyphRow >= 0 && glyphRow < PATH_GLYPH_SIZE) {
+                    bits = pgm_read_byte(&PATH_GLYPHS[glyph][glyphRow]);
+                }
+                for (int px = 0; px < size; px++) {
+                    int glyphCol = px - glyphStart;
+                    bool set = bits && glyphCol >= 0 && glyphCol < PATH_GLYPH_SIZE &&
+                               ((bits >> (PATH_GLYPH_SIZE - 1 - glyphCol)) & 1);
+                    out[px] = set ? GRID_ARROW_COLOR : color;
                 }
             }
         }
     }
 }
+#endif
+
+void UIGrid::drawCell(Display &tft, GridModel &model, UIState state, int row, int col) {
+    int cellX = col * CELL_SIZE + x + 1;
+    int cellY = row * CELL_SIZE + y + 1;
+    uint16_t color = cellColor(model, state, row, col);
+    int glyph = cellGlyph(model, row, col);
+    if (glyph >= 0) {
+        batchBlitGlyph(tft, cellX, cellY, CELL_SIZE - 1, color, GRID_ARROW_COLOR, glyph);
+    } else {
+        batchFillRect(tft, cellX, cellY, CELL_SIZE - 1, CELL_SIZE - 1, color);
+    }
+}
+
+uint16_t UIGrid::cellColor(GridModel &model, UIState state, int row, int col) {
+    if (model.isCellActivated(row, col)) {
+        if (state == RUNNING || state == COMPLETE) {
+            // Position of this cell in the path, processed cells are highlighted
+            int pathIndex = model.pathIndexAt(row, col);
+            bool isProcessed = pathIndex >= 0 && pathIndex <= model.getCurrentPathIndex();
+            if (isProcessed) {
+                return GRID_SELECTABLE_COLOR;
+            }
+        }
+        return GRID_SELECTED_COLOR;
+    } else if (state == IDLE && model.isSelectable(row, col)) {
+        return GRID_SELECTABLE_COLOR;
+    }
+    return GRID_EMPTY_COLOR;
+}
+
+int UIGrid::cellGlyph(GridModel &model, int row, int col) {
+    // Path cells show the direction of their outgoing step, the last cell a dot
+    int pathIndex = model.pathIndexAt(row, col);
+    if (pathIndex < 0) {
+        return -1;
+    }
+    if (pathIndex == model.getPathLength() - 1) {
+        return PATH_GLYPH_END;
+    }
+    return model.getPath().stepDirection(pathIndex);
+}
 
 bool UIGrid::isPointInRect(int x, int y, int rectX, int rectY, int rectWidth, int rectHeight) {
     return x >= rectX && x <= rectX + rectWidth && y >= rectY && y <= rectY + rectHeight;
@@ -1,10 +1,13 @@
 #ifndef UI_ELEMENTS_H
 #define UI_ELEMENTS_H
 
-#include <Adafruit_ILI9341.h>
 #include <Arduino.h>
+#include "display.h"
 #include "grid_model.h"
 #include "state.h"
+#include "ui_text.h"
+#include "icons.h"
+#include "ui_hit_map.h"
 
 // UI Configuration Constants
 #define CELL_SIZE 30
@@ -16,8 +19,10 @@ const int FONT_CHAR_HEIGHT = 8;
 // Button dimensions
 const int BUTTON_HEIGHT = 36;
 const int BUTTON_MARGIN = 2;
-const int UNDO_BUTTON_WIDTH = 36;
-const int SETTINGS_BUTTON_WIDTH = 36;
+const int UNDO_BUTTON_WIDTH = 30;
+const int REDO_BUTTON_WIDTH = 30;
+const int SETTINGS_BUTTON_WIDTH = 30;
+const int OPTIMIZE_BUTTON_WIDTH = 30;
 
 // Background color
 const uint16_t BACKGROUND_COLOR = 0x0000; // Black
@@ -51,6 +56,65 @@ const int SETTINGS_ARROW_HEIGHT = 30;
 const int SETTINGS_ARROW_MARGIN_X = 2;
 const int SETTINGS_FONT_PADDING = SETTINGS_TEXT_SIZE;
 const int SETTINGS_OPTION_SPACING = 70;
+const int SETTINGS_DRAW_BAND_LINES = 16;  // Background lines filled per drawing part
+
+// Grid drawing mode, 1 batches each grid frame into a single SPI transaction
+#ifndef UI_BATCHED_DRAW
+#define UI_BATCHED_DRAW 1
+#endif
+
+// Grid compositing. When non-zero the grid is rendered into an offscreen RGB565
+// strip this many pixel lines tall and each strip is pushed with one bulk
+// write, so lines, fills and glyphs never flash. The strip costs
+// (GRID_MAX_COLS * CELL_SIZE + 1) * 2 bytes of SRAM per line, about 12.7 KB
+// for one 31 line cell row at the default capacity. 0 keeps the direct path.
+#ifndef UI_STRIP_LINES
+#define UI_STRIP_LINES 0
+#endif
+
+// Time budget for one run of the render task, shared by the grid flush and
+// the settings menu, which both draw in slices. With SPI DMA
+// (USE_SPI_DMA in Adafruit_SPITFT) composited strips are sent in the background.
+#ifndef UI_FLUSH_SLICE_MICROS
+#define UI_FLUSH_SLICE_MICROS 4000
+#endif
+
+// Draw cost counters, enabled by building with UI_DRAW_STATS defined
+#ifdef UI_DRAW_STATS
+struct UIDrawStats {
+  unsigned long transactions;
+  unsigned long addressWindows;
+  unsigned long pixels;
+};
+extern UIDrawStats uiDrawStats;
+void resetDrawStats();
+void printDrawStats(Print &out, const char *label);
+#endif
+
+// Text drawn glyph by glyph that remembers what is on screen. Redrawing
+// repaints only the character cells that changed, each cell background and
+// foreground together in one address window, and clears cells the previous
+// text covered that the new text does not.
+class UIGlyphText {
+public:
+    UIGlyphText();
+
+    void draw(Display &tft, int tx, int ty, const char *text,
+              uint8_t size, uint16_t fg, uint16_t bg);
+
+    // Forget the screen contents, the next draw paints every glyph
+    void invalidate() { valid = false; }
+    bool isDrawnOn(uint16_t bg) const { return valid && drawnBg == bg; }
+
+private:
+    char drawn[UI_TEXT_CAPACITY];
+    int drawnX;
+    int drawnY;
+    uint8_t drawnSize;
+    uint16_t drawnFg;
+    uint16_t drawnBg;
+    bool valid;
+};
 
 // Base class now only contains what is common to ALL buttons.
 class UIButton {
@@ -77,28 +141,35 @@ public:
   void setBgColor(uint16_t color) { bgColor = color; }
 
   // The base draw method is now virtual.
-  virtual void draw(Adafruit_ILI9341 &tft) const;
+  virtual void draw(Display &tft) const;
 };
 
 class UITextButton : public UIButton {
 public:
-  String label;
+  char label[UI_TEXT_CAPACITY];
   uint16_t textColor;
   uint8_t textSize;
 
-  UITextButton() : label(""), textColor(BUTTON_TEXT_COLOR), textSize(2) {}
+  UITextButton() : textColor(BUTTON_TEXT_COLOR), textSize(2) { label[0] = '\0'; }
 
-  void setLabel(const String &l) { label = l; }
+  void setLabel(const char *l) { copyText(label, sizeof(label), l); }
   void setTextColor(uint16_t c) { textColor = c; }
   void setTextSize(uint8_t size) { textSize = size; }
 
   // This is the primary drawing method for this class.
-  void draw(Adafruit_ILI9341 &tft) const override;
+  void draw(Display &tft) const override;
+  // Repaint after a label or colour change, touching only changed glyphs
+  void update(Display &tft) const;
+
+private:
+  mutable UIGlyphText text;  // Glyphs currently on screen
+
+  void textOrigin(int &textX, int &textY) const;
 };
 
 class UIIconButton : public UIButton {
 public:
-  const uint16_t *icon;
+  const uint8_t *icon;  // Compressed icon, see icons.h
   int iconWidth;
   int iconHeight;
 
@@ -106,14 +177,15 @@ public:
     bgColor = BUTTON_BACKGROUND_COLOR;  // Set default background color
   }
 
-  void setIcon(const uint16_t *i, int w, int h) {
+  // The icon size is read from the compressed header
+  void setIcon(const uint8_t *i) {
     icon = i;
-    iconWidth = w;
-    iconHeight = h;
+    iconWidth = pgm_read_byte(i + ICON_WIDTH_OFFSET);
+    iconHeight = pgm_read_byte(i + ICON_HEIGHT_OFFSET);
   }
 
   // This is the primary drawing method for this class.
-  void draw(Adafruit_ILI9341 &tft) const override;
+  void draw(Display &tft) const override;
 };
 
 enum ArrowDirection { ARROW_LEFT, ARROW_RIGHT };
@@ -135,7 +207,7 @@ public:
   void setTriangleColor(uint16_t color) { triangleColor = color; }
 
   // Override the draw method to draw the arrow
-  void draw(Adafruit_ILI9341 &tft) const override;
+  void draw(Display &tft) const override;
 };
 
 class UISettingsValue {
@@ -146,13 +218,12 @@ public:
     uint16_t backgroundColor;
     uint16_t textColor;
     uint8_t textSize;
-    String value;
+    char value[UI_TEXT_CAPACITY];
 
     UISettingsValue() : x(0), y(0), width(0),
                        backgroundColor(SETTINGS_BACKGROUND_COLOR),
                        textColor(SETTINGS_TEXT_COLOR),
-                       textSize(2),
-                       value("") {}
+                       textSize(2) { value[0] = '\0'; }
 
     void setPosition(int bx, int by, int w) {
         x = bx;
@@ -166,14 +237,21 @@ public:
     }
 
     void setTextSize(uint8_t size) { textSize = size; }
-    void setValue(const String &val) { value = val; }
+    void setValue(const char *val) { copyText(value, sizeof(value), val); }
+
+    void draw(Display &tft) const;
+    // Repaint after a value change, touching only changed glyphs
+    void update(Display &tft) const;
+
+private:
+    mutable UIGlyphText text;  // Glyphs currently on screen
 
-    void draw(Adafruit_ILI9341 &tft) const;
+    int textOriginX() const;
 };
 
 class UISettingsOption {
 public:
-    String label;
+    const char *label;  // Static string, not copied
     UIArrow leftArrow;
     UIArrow rightArrow;
     UISettingsValue value;
@@ -207,7 +285,7 @@ public:
         height = h;
     }
 
-    void setLabel(const String &l) { label = l; }
+    void setLabel(const char *l) { label = l; }
     void setColors(uint16_t bg, uint16_t txt) {
         backgroundColor = bg;
         textColor = txt;
@@ -219,10 +297,10 @@ public:
     }
     void setArrowMargin(int margin) { arrowMarginX = margin; }
     void setOptionSpacing(int spacing) { optionSpacing = spacing; }
-    void setValue(const String &val) { value.setValue(val); }
+    void setValue(const char *val) { value.setValue(val); }
 
     void layout();
-    void draw(Adafruit_ILI9341 &tft) const;
+    void draw(Display &tft) const;
 };
 
 class UISettingsMenu {
@@ -251,7 +329,8 @@ public:
                       arrowHeight(SETTINGS_ARROW_HEIGHT),
                       arrowMarginX(SETTINGS_ARROW_MARGIN_X),
                       optionSpacing(SETTINGS_OPTION_SPACING),
-                      numOptions(0) {}
+                      numOptions(0),
+                      nextPart(0) {}
 
     void setPosition(int bx, int by, int w, int h) {
         x = bx;
@@ -275,19 +354,25 @@ public:
     void setOptionSpacing(int spacing) { optionSpacing = spacing; }
 
     void layout();
-    void draw(Adafruit_ILI9341 &tft) const;
-    int optionIndexContaining(int px, int py) const; // Returns index of option containing the point, or -1 if none
+    void draw(Display &tft) const;
+
+    // Drawing in parts, so no single call holds the display for long: the
+    // background in bands, the border, then one option per part
+    void beginDraw() { nextPart = 0; }
+    bool drawSlice(Display &tft, unsigned long budgetMicros);  // Draws parts for up to budgetMicros (0 for no limit), true while parts remain
+    bool isDrawStarted() const { return nextPart > 0; }  // Some part is on screen since beginDraw()
+
+    // Register the option arrows as touch targets, each hit carries its option
+    // index. Returns false if the map ran out of regions.
+    bool addHitRegions(UIHitMap &map, uint8_t states, uint8_t events,
+                       UIHitHandler onLeftArrow, UIHitHandler onRightArrow) const;
 
     // Helper methods for setup and updates
-    void setupOptions(const String* labels, int count);
-    void updateOptionValue(int optionIndex, const String& value);
+    void setupOptions(const char* const* labels, int count);
+    void updateOptionValue(int optionIndex, const char* value);
 
     // Add this method to the UISettingsMenu class
-    void redrawOption(int optionIndex, Adafruit_ILI9341 &tft) const;
-
-    // Helper functions for arrow hit-testing
-    bool leftArrowContains(int px, int py, int optionIndex) const;
-    bool rightArrowContains(int px, int py, int optionIndex) const;
+    void redrawOption(int optionIndex, Display &tft) const;
 
     // Check if a point is within the menu bounds
     bool contains(int px, int py) const {
@@ -302,6 +387,10 @@ private:
     static const int MAX_OPTIONS = 3;
     UISettingsOption options[MAX_OPTIONS];
     int numOptions;
+    int nextPart;  // Next part drawSlice() draws
+
+    int partCount() const;
+    void drawPart(Display &tft, int part) const;
 };
 
 // --- UIGrid class for grid UI management ---
@@ -313,11 +402,32 @@ public:
     UIGrid();
     void setSize(int rows, int cols);
     void setBounds(int bx, int by, int w, int h);
-    void drawGridLines(Adafruit_ILI9341 &tft);
-    void drawGridCells(Adafruit_ILI9341 &tft, GridModel &model, UIState state);
-    void drawGridCells(Adafruit_ILI9341 &tft, GridModel &model, UIState state, int startRow, int endRow, int startCol, int endCol);
+    void drawGridLines(Display &tft);
+    void drawGridCells(Display &tft, GridModel &model, UIState state);
+    void drawGridCells(Display &tft, GridModel &model, UIState state, int startRow, int endRow, int startCol, int endCol);
+    void flush(Display &tft, GridModel &model, UIState state);  // Redraws only cells marked dirty in the model
+    bool flushSlice(Display &tft, GridModel &model, UIState state, unsigned long budgetMicros);  // Redraws dirty cells for up to budgetMicros (0 for no limit), true while work remains
+    void finishTransfer(Display &tft);  // Waits for a background strip transfer, call before other drawing
+    void restoreRegion(Display &tft, GridModel &model, int rx, int ry, int rw, int rh);  // Repaints the grid under a closed overlay
+    void redrawAll(Display &tft, GridModel &model, UIState state);  // Full repaint of lines and cells
     static bool isPointInRect(int x, int y, int rectX, int rectY, int rectWidth, int rectHeight);
     bool contains(int x, int y) const;
+
+private:
+    void drawCell(Display &tft, GridModel &model, UIState state, int row, int col);
+    uint16_t cellColor(GridModel &model, UIState state, int row, int col);
+    int cellGlyph(GridModel &model, int row, int col);  // Glyph index, or -1 for a plain cell
+#if UI_STRIP_LINES
+    static const int STRIP_COUNT = (GRID_MAX_ROWS * CELL_SIZE + UI_STRIP_LINES) / UI_STRIP_LINES;
+    uint8_t pendingStrips[(STRIP_COUNT + 7) / 8];  // Strips still to send in the current pass
+    int nextStrip;
+    bool passActive;
+    bool transferPending;
+
+    bool flushCompositedSlice(Display &tft, GridModel &model, UIState state, unsigned long budgetMicros);
+    bool isStripDirty(GridModel &model, int top, int lines);
+    void composeStrip(GridModel &model, UIState state, int top, int lines, int stripWidth);
+#endif
 };
 
 #endif
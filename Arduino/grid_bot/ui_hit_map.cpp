@@ -0,0 +1,81 @@
+#include "ui_hit_map.h"
+
+UIHitMap::UIHitMap() {
+  clear();
+}
+
+void UIHitMap::clear() {
+  regionCount = 0;
+  memset(tileMasks, 0, sizeof(tileMasks));
+  memset(stateMasks, 0, sizeof(stateMasks));
+}
+
+bool UIHitMap::add(int rx, int ry, int rw, int rh, uint8_t states, uint8_t events, UIHitHandler handler, int arg) {
+  return addCells(rx, ry, rw, rh, 1, 1, states, events, handler, arg);
+}
+
+bool UIHitMap::addCells(int rx, int ry, int cellWidth, int cellHeight, int rows, int cols,
+                        uint8_t states, uint8_t events, UIHitHandler handler, int arg) {
+  if (regionCount >= UI_HIT_MAX_REGIONS || cellWidth <= 0 || cellHeight <= 0 || rows <= 0 || cols <= 0) {
+    return false;
+  }
+  int index = regionCount++;
+  Region &region = regions[index];
+  region.x = rx;
+  region.y = ry;
+  region.width = cellWidth * cols;
+  region.height = cellHeight * rows;
+  region.cellWidth = rows > 1 || cols > 1 ? cellWidth : 0;
+  region.cellHeight = cellHeight;
+  region.states = states;
+  region.events = events;
+  region.handler = handler;
+  region.arg = arg;
+
+  // Mark the tiles the region overlaps, clipped to the mapped area
+  uint16_t bit = 1 << index;
+  int left = max(rx, 0) >> UI_HIT_TILE_SHIFT;
+  int top = max(ry, 0) >> UI_HIT_TILE_SHIFT;
+  int right = min((rx + region.width - 1) >> UI_HIT_TILE_SHIFT, UI_HIT_TILES - 1);
+  int bottom = min((ry + region.height - 1) >> UI_HIT_TILE_SHIFT, UI_HIT_TILES - 1);
+  for (int ty = top; ty <= bottom; ty++) {
+    for (int tx = left; tx <= right; tx++) {
+      tileMasks[ty][tx] |= bit;
+    }
+  }
+  for (int state = 0; state < 8; state++) {
+    if (states & (1 << state)) {
+      stateMasks[state] |= bit;
+    }
+  }
+  return true;
+}
+
+bool UIHitMap::dispatch(int px, int py, UIState state, uint8_t event) const {
+  if (px < 0 || py < 0 || px >= UI_HIT_MAX_SIZE || py >= UI_HIT_MAX_SIZE) {
+    return false;
+  }
+
+  // Candidates overlap the tile and are active in this state, lowest index first
+  uint16_t candidates = tileMasks[py >> UI_HIT_TILE_SHIFT][px >> UI_HIT_TILE_SHIFT] & stateMasks[state & 7];
+  for (int index = 0; candidates != 0; index++, candidates >>= 1) {
+    if (!(candidates & 1)) {
+      continue;
+    }
+    const Region &region = regions[index];
+    if (!(region.events & event) || px < region.x || py < region.y ||
+        px >= region.x + region.width || py >= region.y + region.height) {
+      continue;
+    }
+
+    UIHit hit;
+    hit.x = px;
+    hit.y = py;
+    hit.row = region.cellWidth ? (py - region.y) / region.cellHeight : 0;
+    hit.col = region.cellWidth ? (px - region.x) / region.cellWidth : 0;
+    hit.arg = region.arg;
+    region.handler(hit);
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,78 @@
+#ifndef UI_HIT_MAP_H
+#define UI_HIT_MAP_H
+
+#include <Arduino.h>
+#include "state.h"
+
+// Most regions a map can hold, one bit each in the tile masks
+const int UI_HIT_MAX_REGIONS = 16;
+
+// Screen area covered by the tile lookup, large enough for either rotation
+const int UI_HIT_MAX_SIZE = 320;
+
+// Tiles are 32 pixels square
+const int UI_HIT_TILE_SHIFT = 5;
+const int UI_HIT_TILES = (UI_HIT_MAX_SIZE + (1 << UI_HIT_TILE_SHIFT) - 1) >> UI_HIT_TILE_SHIFT;
+
+// Mask bit of a UI state, for the states a region is active in
+#define UI_STATE_BIT(state) (1 << (state))
+const uint8_t UI_ALL_STATES = 0xFF;
+
+// Where a touch landed within the region that took it
+struct UIHit {
+  int x;     // Touch position in pixels
+  int y;
+  int row;   // Cell of a region added with addCells(), 0 otherwise
+  int col;
+  int arg;   // Value the region was registered with
+};
+
+typedef void (*UIHitHandler)(const UIHit &hit);
+
+// Routes touches to the handlers of screen regions. Regions are registered
+// at layout time with the UI states and touch events they respond to. Each
+// 32 pixel tile of the screen keeps a mask of the regions overlapping it,
+// so a lookup tests only those few regions instead of every widget.
+class UIHitMap {
+public:
+  UIHitMap();
+
+  // Remove every region
+  void clear();
+
+  // Register a rectangle, returns false when the map is full. The rectangle
+  // covers rx to rx + rw - 1 and ry to ry + rh - 1, the pixels a widget of
+  // that size draws. Where regions overlap the one added first wins. Events
+  // is a mask of caller defined event bits, such as 1 << TOUCH_TAP.
+  bool add(int rx, int ry, int rw, int rh, uint8_t states, uint8_t events, UIHitHandler handler, int arg = 0);
+
+  // Register a rows x cols block of equal cells, hits report the cell
+  bool addCells(int rx, int ry, int cellWidth, int cellHeight, int rows, int cols,
+                uint8_t states, uint8_t events, UIHitHandler handler, int arg = 0);
+
+  // Call the handler of the region under a point, returns false if none
+  bool dispatch(int px, int py, UIState state, uint8_t event) const;
+
+private:
+  struct Region {
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+    int16_t cellWidth;    // 0 for a plain rectangle
+    int16_t cellHeight;
+    uint8_t states;
+    uint8_t events;
+    UIHitHandler handler;
+    int arg;
+  };
+
+  Region regions[UI_HIT_MAX_REGIONS];
+  int regionCount;
+
+  // Regions overlapping each tile, and regions active in each state
+  uint16_t tileMasks[UI_HIT_TILES][UI_HIT_TILES];
+  uint16_t stateMasks[8];
+};
+
+#endif
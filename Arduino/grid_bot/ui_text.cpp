@@ -0,0 +1,48 @@
+#include "ui_text.h"
+
+UI_FORBID_STRING
+
+size_t copyText(char *dst, size_t size, const char *src) {
+  if (size == 0) {
+    return 0;
+  }
+  size_t len = 0;
+  while (src[len] != '\0' && len < size - 1) {
+    dst[len] = src[len];
+    len++;
+  }
+  dst[len] = '\0';
+  return len;
+}
+
+size_t formatInt(char *dst, size_t size, long value) {
+  // Write the digits backwards into scratch space, then copy them over
+  char digits[12];
+  int count = 0;
+  unsigned long magnitude = value < 0 ? 0UL - (unsigned long)value : (unsigned long)value;
+  do {
+    digits[count++] = '0' + magnitude % 10;
+    magnitude /= 10;
+  } while (magnitude > 0);
+  if (value < 0) {
+    digits[count++] = '-';
+  }
+
+  size_t len = 0;
+  while (count > 0 && len + 1 < size) {
+    dst[len++] = digits[--count];
+  }
+  if (size > 0) {
+    dst[len] = '\0';
+  }
+  return len;
+}
+
+size_t formatPercent(char *dst, size_t size, int value) {
+  size_t len = formatInt(dst, size, value);
+  if (len + 1 < size) {
+    dst[len++] = '%';
+    dst[len] = '\0';
+  }
+  return len;
+}
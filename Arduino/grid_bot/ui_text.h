@@ -0,0 +1,20 @@
+#ifndef UI_TEXT_H
+#define UI_TEXT_H
+
+#include <Arduino.h>
+
+// Fixed-capacity text for UI labels and values. Widgets keep their text in
+// char buffers of this size so redraws never touch the heap.
+const size_t UI_TEXT_CAPACITY = 12;  // "Extended" and "100%" fit with room to spare
+
+// Placed after the includes of a UI source file, turns any later use of
+// Arduino String into a compile error so UI updates stay allocation-free
+#define UI_FORBID_STRING _Pragma("GCC poison String")
+
+// Text helpers. Each writes a NUL-terminated string into dst, truncating to
+// fit size, and returns the number of characters written.
+size_t copyText(char *dst, size_t size, const char *src);
+size_t formatInt(char *dst, size_t size, long value);
+size_t formatPercent(char *dst, size_t size, int value);
+
+#endif
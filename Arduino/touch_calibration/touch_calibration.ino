@@ -2,6 +2,14 @@
 #include <Adafruit_GFX.h>       // Core graphics library
 #include <Adafruit_ILI9341.h>   // Specific driver for the ILI9341 display
 #include "TouchScreen.h"       // Resistive touchscreen driver
+// SAMD boards only emulate EEPROM in the sketch's own flash, which uploading
+// grid_bot erases, so there the result is only printed for compiling in
+#if defined(ARDUINO_ARCH_SAMD)
+#define CALIBRATION_STORED 0
+#else
+#define CALIBRATION_STORED 1
+#include <EEPROM.h>             // Calibration storage
+#endif
 
 // --- TFT display pin assignments ---
 #define TFT_CS 17   // Chip select
@@ -15,34 +23,56 @@
 #define YM 23  // Can be any digital pin
 #define XM A7  // Must be an analog pin
 
+// --- Calibration settings ---
+#define TARGET_COUNT 5          // Four corners and one inner target
+#define TARGET_PADDING 20       // Distance of the corner targets from the edges
+#define SAMPLES_PER_TARGET 16   // Readings taken while a target is held
+#define SAMPLE_TOLERANCE 8      // Raw units a reading may stray from the median
+#define MAX_RESIDUAL 6.0        // Pixels a target may miss the fitted transform by
+
+// --- Calibration record, must match TouchCalibrationRecord in grid_bot ---
+#define CALIBRATION_ADDRESS 0
+const uint32_t CALIBRATION_MAGIC = 0x54434131;  // "TCA1"
+
+struct CalibrationRecord {
+  uint32_t magic;
+  int32_t coeffs[6];   // xx, xy, x0, yx, yy, y0 in 16.16 fixed point
+  uint32_t checksum;   // magic and coefficients XORed together
+};
+
 // --- Display and touch objects ---
 Adafruit_ILI9341 tft = Adafruit_ILI9341(TFT_CS, TFT_DC, TFT_RST); // TFT driver
 TouchScreen ts = TouchScreen(XP, YP, XM, YM, 300);               // Touch driver
 
-// Structure to store a single raw touch reading
-struct TouchPoint { int x; int y; };
-
-// Buffer of four corner samples
-TouchPoint samples[4];
+// A target on screen and the averaged raw reading taken at it
+struct CalibrationPoint {
+  int screenX;
+  int screenY;
+  float rawX;
+  float rawY;
+  bool used;   // Cleared when the point is rejected as an outlier
+};
 
-// Current sample being requested
-int sampleIndex = 0;
+CalibrationPoint points[TARGET_COUNT];
 
-// Draw a crosshair in one of the four corners to prompt the user
-void drawCrosshair(int index) {
-  int padding = 20;        // Distance from edge for the crosshair
-  int x = padding;         // Default to upper-left corner
-  int y = padding;
+// Fitted transform, screen = coeffs * (rawX, rawY, 1)
+double coeffs[6];
 
-  // Choose corner based on sample index
+// Screen position of a target. The inner target sits off both diagonals,
+// so no three targets are in line and any four still over-determine the
+// transform, which lets one bad target be singled out.
+void targetPosition(int index, int &x, int &y) {
   switch (index) {
-    case 0: x = padding; y = padding; break;                          // Top-left
-    case 1: x = tft.width() - padding; y = padding; break;            // Top-right
-    case 2: x = tft.width() - padding; y = tft.height() - padding; break; // Bottom-right
-    case 3: x = padding; y = tft.height() - padding; break;           // Bottom-left
+    case 0: x = TARGET_PADDING; y = TARGET_PADDING; break;                                // Top-left
+    case 1: x = tft.width() - TARGET_PADDING; y = TARGET_PADDING; break;                  // Top-right
+    case 2: x = tft.width() - TARGET_PADDING; y = tft.height() - TARGET_PADDING; break;   // Bottom-right
+    case 3: x = TARGET_PADDING; y = tft.height() - TARGET_PADDING; break;                 // Bottom-left
+    default: x = tft.width() / 4; y = tft.height() / 2; break;                            // Inner
   }
+}
 
-  // Clear the screen and draw the lines forming the crosshair
+// Clear the screen and draw the crosshair for a target
+void drawCrosshair(int x, int y, int index) {
   tft.fillScreen(ILI9341_BLACK);
   tft.drawFastHLine(x - 5, y, 10, ILI9341_WHITE);
   tft.drawFastVLine(x, y - 5, 10, ILI9341_WHITE);
@@ -52,6 +82,213 @@ void drawCrosshair(int index) {
   Serial.println(index + 1);
 }
 
+// Wait until the panel is released
+void waitForRelease() {
+  int quiet = 0;
+  while (quiet < 10) {
+    TSPoint p = ts.getPoint();
+    quiet = p.z > ts.pressureThreshhold ? 0 : quiet + 1;
+    delay(5);
+  }
+}
+
+// Insertion sort for the median of a handful of readings
+void sortValues(int *values, int count) {
+  for (int i = 1; i < count; i++) {
+    int v = values[i];
+    int j = i - 1;
+    while (j >= 0 && values[j] > v) {
+      values[j + 1] = values[j];
+      j--;
+    }
+    values[j + 1] = v;
+  }
+}
+
+// Read a held target. Readings far from the median of the set are dropped
+// and the rest averaged. Returns false if too few readings agree.
+bool readTarget(CalibrationPoint &point) {
+  int xs[SAMPLES_PER_TARGET];
+  int ys[SAMPLES_PER_TARGET];
+
+  // Collect pressure qualified readings while the target is held
+  int count = 0;
+  while (count < SAMPLES_PER_TARGET) {
+    TSPoint p = ts.getPoint();
+    if (p.z > ts.pressureThreshhold) {
+      xs[count] = p.x;
+      ys[count] = p.y;
+      count++;
+    }
+    delay(5);
+  }
+  waitForRelease();
+
+  // Median of each axis
+  int sortedX[SAMPLES_PER_TARGET];
+  int sortedY[SAMPLES_PER_TARGET];
+  memcpy(sortedX, xs, sizeof(xs));
+  memcpy(sortedY, ys, sizeof(ys));
+  sortValues(sortedX, count);
+  sortValues(sortedY, count);
+  int medianX = sortedX[count / 2];
+  int medianY = sortedY[count / 2];
+
+  // Average the readings close to the median
+  long sumX = 0;
+  long sumY = 0;
+  int kept = 0;
+  for (int i = 0; i < count; i++) {
+    if (abs(xs[i] - medianX) <= SAMPLE_TOLERANCE && abs(ys[i] - medianY) <= SAMPLE_TOLERANCE) {
+      sumX += xs[i];
+      sumY += ys[i];
+      kept++;
+    }
+  }
+  if (kept < count / 2) {
+    return false;
+  }
+  point.rawX = (float)sumX / kept;
+  point.rawY = (float)sumY / kept;
+  return true;
+}
+
+// Determinant of a 3x3 matrix
+double det3(double m[3][3]) {
+  return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+         m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+         m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+}
+
+// Least squares affine fit over the used points. Solves the 3x3 normal
+// equations for each screen axis with Cramer's rule.
+bool fitTransform() {
+  double m[3][3] = { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } };
+  double bx[3] = { 0, 0, 0 };
+  double by[3] = { 0, 0, 0 };
+  for (int i = 0; i < TARGET_COUNT; i++) {
+    if (!points[i].used) {
+      continue;
+    }
+    double row[3] = { points[i].rawX, points[i].rawY, 1.0 };
+    for (int r = 0; r < 3; r++) {
+      for (int c = 0; c < 3; c++) {
+        m[r][c] += row[r] * row[c];
+      }
+      bx[r] += row[r] * points[i].screenX;
+      by[r] += row[r] * points[i].screenY;
+    }
+  }
+
+  double d = det3(m);
+  if (fabs(d) < 1e-6) {
+    return false;
+  }
+  for (int k = 0; k < 3; k++) {
+    double mx[3][3];
+    double my[3][3];
+    for (int r = 0; r < 3; r++) {
+      for (int c = 0; c < 3; c++) {
+        mx[r][c] = c == k ? bx[r] : m[r][c];
+        my[r][c] = c == k ? by[r] : m[r][c];
+      }
+    }
+    coeffs[k] = det3(mx) / d;
+    coeffs[3 + k] = det3(my) / d;
+  }
+  return true;
+}
+
+// Distance in pixels between a target and where the transform maps its reading
+double residual(const CalibrationPoint &point) {
+  double x = coeffs[0] * point.rawX + coeffs[1] * point.rawY + coeffs[2];
+  double y = coeffs[3] * point.rawX + coeffs[4] * point.rawY + coeffs[5];
+  return sqrt((x - point.screenX) * (x - point.screenX) + (y - point.screenY) * (y - point.screenY));
+}
+
+// Largest residual over the used points
+double worstResidual() {
+  double worst = 0;
+  for (int i = 0; i < TARGET_COUNT; i++) {
+    if (points[i].used && residual(points[i]) > worst) {
+      worst = residual(points[i]);
+    }
+  }
+  return worst;
+}
+
+// Fit the transform. If some target misses it, each target is left out in
+// turn and the one whose absence lets the others agree best is ignored.
+// Returns false if there is still no good fit.
+bool solveCalibration() {
+  if (!fitTransform()) {
+    return false;
+  }
+  if (worstResidual() <= MAX_RESIDUAL) {
+    return true;
+  }
+
+  // Fit without each target in turn and measure how well the rest agree.
+  // Four targets absorb more of an error, so they must agree more closely.
+  int worst = -1;
+  double bestResidual = MAX_RESIDUAL / 2;
+  for (int i = 0; i < TARGET_COUNT; i++) {
+    points[i].used = false;
+    if (fitTransform() && worstResidual() <= bestResidual) {
+      bestResidual = worstResidual();
+      worst = i;
+    }
+    points[i].used = true;
+  }
+  if (worst < 0) {
+    return false;
+  }
+  points[worst].used = false;
+  fitTransform();
+  Serial.print("Ignoring crosshair ");
+  Serial.print(worst + 1);
+  Serial.print(", off by ");
+  Serial.print(residual(points[worst]), 1);
+  Serial.println(" px");
+  return true;
+}
+
+// Store the transform as 16.16 fixed point for grid_bot to load at boot
+void saveCalibration(CalibrationRecord &record) {
+  record.magic = CALIBRATION_MAGIC;
+  record.checksum = CALIBRATION_MAGIC;
+  for (int i = 0; i < 6; i++) {
+    record.coeffs[i] = (int32_t)lround(coeffs[i] * 65536.0);
+    record.checksum ^= (uint32_t)record.coeffs[i];
+  }
+#if CALIBRATION_STORED
+  // Byte by byte, unchanged bytes are not rewritten
+  const uint8_t *bytes = (const uint8_t *)&record;
+  for (size_t i = 0; i < sizeof(record); i++) {
+    EEPROM.update(CALIBRATION_ADDRESS + i, bytes[i]);
+  }
+#endif
+}
+
+// Run the whole procedure until a fit is found
+void calibrate() {
+  while (true) {
+    // Collect every target, repeating any whose readings are too noisy
+    for (int i = 0; i < TARGET_COUNT; i++) {
+      targetPosition(i, points[i].screenX, points[i].screenY);
+      points[i].used = true;
+      drawCrosshair(points[i].screenX, points[i].screenY, i);
+      while (!readTarget(points[i])) {
+        Serial.println("Readings too noisy, touch the crosshair again");
+      }
+    }
+    if (solveCalibration()) {
+      return;
+    }
+    Serial.println("Touches do not fit together, starting again");
+  }
+}
+
 // Arduino setup function -- runs once at boot
 void setup() {
   Serial.begin(9600);       // Initialize serial output
@@ -65,44 +302,38 @@ void setup() {
   tft.setRotation(0);       // Portrait orientation
   tft.fillScreen(ILI9341_BLACK);
 
-  // Print instructions and show the first crosshair
+  // Print instructions and collect the targets
   Serial.println("Touchscreen calibration");
-  drawCrosshair(sampleIndex);
+  calibrate();
+
+  // Store the result and print it for builds without persistent storage
+  CalibrationRecord record;
+  saveCalibration(record);
+  Serial.println();
+#if CALIBRATION_STORED
+  Serial.println("Calibration complete and stored. grid_bot loads it at boot.");
+  Serial.println("To compile it into grid_bot instead, use:");
+#else
+  Serial.println("Calibration complete. Add this line to grid_bot.ino:");
+#endif
+  Serial.print("#define TOUCH_CALIBRATION_MATRIX { ");
+  for (int i = 0; i < 6; i++) {
+    Serial.print(record.coeffs[i]);
+    Serial.print(i < 5 ? ", " : " }\n");
+  }
+
+  // Leave a test screen up
+  tft.fillScreen(ILI9341_BLACK);
+  Serial.println("Touch the screen to check the calibration");
 }
 
-// Main loop -- collect touches from all four corners
+// Main loop -- draw a dot where each touch maps to
 void loop() {
-  // Read raw coordinates from the touchscreen
   TSPoint p = ts.getPoint();
-
-  // Check if the screen is being touched
   if (p.z > ts.pressureThreshhold) {
-    // Store the raw reading
-    samples[sampleIndex].x = p.x;
-    samples[sampleIndex].y = p.y;
-    sampleIndex++;
-    delay(500);  // Debounce delay
-
-    // Prompt for the next corner or finish calibration
-    if (sampleIndex < 4) {
-      drawCrosshair(sampleIndex);
-    } else {
-      // Determine min/max for X and Y from the four samples
-      int minX = min(min(samples[0].x, samples[1].x), min(samples[2].x, samples[3].x));
-      int maxX = max(max(samples[0].x, samples[1].x), max(samples[2].x, samples[3].x));
-      int minY = min(min(samples[0].y, samples[2].y), min(samples[1].y, samples[3].y));
-      int maxY = max(max(samples[0].y, samples[2].y), max(samples[1].y, samples[3].y));
-
-      // Print out calibration macros for the user to copy
-      Serial.println();
-      Serial.println("Calibration complete. Use these values:");
-      Serial.print("#define TOUCH_MIN_X "); Serial.println(minX);
-      Serial.print("#define TOUCH_MAX_X "); Serial.println(maxX);
-      Serial.print("#define TOUCH_MIN_Y "); Serial.println(minY);
-      Serial.print("#define TOUCH_MAX_Y "); Serial.println(maxY);
-
-      while (1); // Halt program once calibration is done
-    }
+    int x = (int)lround(coeffs[0] * p.x + coeffs[1] * p.y + coeffs[2]);
+    int y = (int)lround(coeffs[3] * p.x + coeffs[4] * p.y + coeffs[5]);
+    tft.fillCircle(x, y, 2, ILI9341_WHITE);
   }
+  delay(10);
 }
-
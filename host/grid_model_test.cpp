@@ -0,0 +1,93 @@
+// Undo and redo of path steps in GridModel. Pops steps, redoes them and
+// then adds a different step, checking after each change that the redo
+// history is what the undo button leaves behind and that the grid bits and
+// per-cell path positions still agree with the path.
+//
+//   grid_model_test
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "grid_model.h"
+
+static GridModel gridModel;
+static int failures = 0;
+
+static void check(bool condition, const char *step, const char *what) {
+  if (!condition) {
+    fprintf(stderr, "%s: %s\n", step, what);
+    failures++;
+  }
+}
+
+// Every path cell is set and knows its position, every other cell is clear
+static void checkConsistent(const char *step) {
+  int onPath = 0;
+  for (int row = 0; row < gridModel.getNumRows(); row++) {
+    for (int col = 0; col < gridModel.getNumCols(); col++) {
+      int index = gridModel.pathIndexAt(row, col);
+      if (index < 0) {
+        check(!gridModel.getGridValue(row, col), step, "cell off the path is set");
+        continue;
+      }
+      onPath++;
+      check(gridModel.getGridValue(row, col), step, "path cell is not set");
+      PathCell cell = gridModel.getPathCell(index);
+      check(cell.row == row && cell.col == col, step, "path position points at another cell");
+    }
+  }
+  check(onPath == gridModel.getPathLength(), step, "path positions do not match the path length");
+  check(gridModel.countSetCells() == gridModel.getPathLength(), step, "set cells do not match the path length");
+}
+
+static void checkPath(const char *step, int length, int redoLength) {
+  check(gridModel.getPathLength() == length, step, "unexpected path length");
+  check(gridModel.getRedoLength() == redoLength, step, "unexpected redo length");
+  checkConsistent(step);
+}
+
+int main() {
+  gridModel.initGrid(9, 7);
+  PathCell start = gridModel.getPathCell(gridModel.getPathLength() - 1);
+  int length = gridModel.getPathLength();
+
+  // Three steps up from the default path
+  for (int i = 1; i <= 3; i++) {
+    gridModel.pathAdd(start.row - i, start.col);
+  }
+  checkPath("add", length + 3, 0);
+
+  // Undo two steps, the cells are released and kept for redo
+  check(gridModel.pathPop() && gridModel.pathPop(), "pop", "pop failed");
+  checkPath("pop", length + 1, 2);
+  check(gridModel.pathIndexAt(start.row - 2, start.col) == -1, "pop", "popped cell still on the path");
+
+  // Redo one step, it comes back at its old position
+  check(gridModel.pathRedo(), "redo", "redo failed");
+  checkPath("redo", length + 2, 1);
+  check(gridModel.pathIndexAt(start.row - 2, start.col) == length + 1, "redo", "redone cell at the wrong position");
+
+  // A different step drops the rest of the redo history
+  gridModel.pathAdd(start.row - 2, start.col + 1);
+  checkPath("add different", length + 3, 0);
+  check(!gridModel.pathRedo(), "add different", "redo after a different step");
+  check(!gridModel.getGridValue(start.row - 3, start.col), "add different", "dropped redo cell is set");
+  checkConsistent("add different");
+
+  // Re-adding the undone step keeps the redo history after it
+  check(gridModel.pathPop() && gridModel.pathPop(), "pop again", "pop failed");
+  checkPath("pop again", length + 1, 2);
+  gridModel.pathAdd(start.row - 2, start.col);
+  checkPath("add same", length + 2, 1);
+  check(gridModel.pathRedo(), "add same", "redo failed");
+  checkPath("add same", length + 3, 0);
+
+  // Undo stops at the default path
+  while (gridModel.pathPop()) {
+  }
+  checkPath("pop all", length, 3);
+
+  if (failures == 0) {
+    printf("grid_model_test: ok\n");
+  }
+  return failures == 0 ? 0 : 1;
+}
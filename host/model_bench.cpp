@@ -0,0 +1,142 @@
+// GridModel and planner benchmark. Times the model operations the sketch
+// uses on grids from the on-device size up to the build capacity, with a
+// path covering every cell, and prints the results as JSON.
+//
+// The CMake target raises the capacity to the largest grid of interest:
+//   -DGRID_MAX_ROWS=1000 -DGRID_MAX_COLS=1000 -DGRID_MODEL_SRAM_BUDGET=100000000
+//   -DPATH_PLANNER_SRAM_BUDGET=100000000 -DMOTION_PLAN_SRAM_BUDGET=100000000
+// Grids larger than the capacity are skipped. The model's arrays are sized
+// by the capacity, so whole-grid resets cost the same on every grid size.
+
+#include "grid_model.h"
+#include "motion_plan.h"
+#include "path_planner.h"
+#include "settings_manager.h"
+
+static GridModel model;
+static MotionPlan motionPlan;
+static PathPlanner planner;
+static PackedPath serpentine;
+static SettingsManager settingsManager;
+static volatile long sink;  // Keeps results of timed calls alive
+
+struct GridSize {
+  int rows;
+  int cols;
+};
+
+static const GridSize SIZES[] = {
+  { 7, 7 }, { 9, 7 }, { 32, 32 }, { 100, 100 }, { 316, 316 }, { 1000, 1000 }
+};
+
+static bool firstResult = true;
+
+static void report(const GridSize &size, const char *operation, long count, unsigned long elapsedMicros) {
+  printf("%s    {\"rows\": %d, \"cols\": %d, \"operation\": \"%s\", \"count\": %ld, "
+         "\"total_us\": %lu, \"ns_per_op\": %.1f}",
+         firstResult ? "" : ",\n", size.rows, size.cols, operation, count, elapsedMicros,
+         count > 0 ? elapsedMicros * 1000.0 / count : 0.0);
+  firstResult = false;
+}
+
+// Cell i of a path that walks every row in turn, alternating direction,
+// starting at the bottom left
+static PathCell serpentineCell(const GridSize &size, long i) {
+  PathCell cell;
+  int band = i / size.cols;
+  int offset = i % size.cols;
+  cell.row = size.rows - 1 - band;
+  cell.col = band % 2 == 0 ? offset : size.cols - 1 - offset;
+  return cell;
+}
+
+static void benchSize(const GridSize &size) {
+  long cells = (long)size.rows * size.cols;
+  model.initGrid(size.rows, size.cols);
+
+  // resetPath() clears the grid and restores the default path
+  int resets = cells > 10000 ? 20 : 1000;
+  unsigned long start = micros();
+  for (int i = 0; i < resets; i++) {
+    model.resetPath();
+  }
+  report(size, "resetPath", resets, micros() - start);
+
+  // isSelectable() over every cell, with the default path
+  start = micros();
+  long selectable = 0;
+  for (int row = 0; row < size.rows; row++) {
+    for (int col = 0; col < size.cols; col++) {
+      selectable += model.isSelectable(row, col);
+    }
+  }
+  report(size, "isSelectable", cells, micros() - start);
+  sink = selectable;
+
+  // pathAdd() for a path covering the whole grid
+  serpentine.clear();
+  serpentine.push(serpentineCell(size, 0).row, serpentineCell(size, 0).col);
+  model.resetGridValues();
+  model.setPath(serpentine);
+  start = micros();
+  for (long i = 1; i < cells; i++) {
+    PathCell cell = serpentineCell(size, i);
+    model.pathAdd(cell.row, cell.col);
+  }
+  report(size, "pathAdd", cells - 1, micros() - start);
+
+  // Walking the packed path with its iterator
+  start = micros();
+  long checksum = 0;
+  for (PackedPath::Iterator it = model.getPath().begin(); it != model.getPath().end(); ++it) {
+    checksum += (*it).row + (*it).col;
+  }
+  report(size, "pathIterate", model.getPathLength(), micros() - start);
+
+  // Sequential getPathCell(), served by the path cursor cache
+  start = micros();
+  for (int i = 0; i < model.getPathLength(); i++) {
+    checksum += model.getPathCell(i).col;
+  }
+  report(size, "getPathCell", model.getPathLength(), micros() - start);
+  sink = checksum;
+
+  // Advancing along the path as a run does, reading the next heading each step
+  model.clearDirty();
+  start = micros();
+  for (int i = 0; i < model.getPathLength(); i++) {
+    model.setCurrentPathIndex(i);
+    checksum += model.getNextDirection();
+  }
+  report(size, "getNextDirection", model.getPathLength(), micros() - start);
+  sink = checksum;
+
+  // Compiling the full path into motion segments
+  start = micros();
+  motionPlan.compile(model, UP, 2000, 2000);
+  report(size, "motionPlanCompile", model.getPathLength(), micros() - start);
+  sink = motionPlan.getSegmentCount();
+
+  // Planning corner to corner on an empty grid
+  model.resetPath();
+  PathCell from = { (GridCoord)(size.rows - 1), 0 };
+  PathCell to = { 0, (GridCoord)(size.cols - 1) };
+  start = micros();
+  planner.findRoute(model, from, UP, to, false, 2000, 2000);
+  report(size, "findRoute", 1, micros() - start);
+  sink = planner.getRouteCost();
+}
+
+int main() {
+  // Settings are part of every model build, touch them like the sketch does
+  settingsManager.resetToDefaults();
+
+  printf("{\n  \"capacity\": {\"rows\": %d, \"cols\": %d},\n  \"results\": [\n", GRID_MAX_ROWS, GRID_MAX_COLS);
+  for (unsigned i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); i++) {
+    if (SIZES[i].rows <= GRID_MAX_ROWS && SIZES[i].cols <= GRID_MAX_COLS) {
+      benchSize(SIZES[i]);
+    }
+  }
+  printf("\n  ]\n}\n");
+  return 0;
+}
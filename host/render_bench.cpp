@@ -0,0 +1,198 @@
+// Rendering cost benchmark. Runs the real UI drawing code against the host
+// framebuffer and reports the bus traffic of standard UI actions as JSON.
+//
+//   render_bench [--clock HZ] [--check BUDGETS] [--write-budgets BUDGETS]
+//
+// --clock sets the SPI clock used for the time estimate (default 24 MHz).
+// --check compares every scenario against a budget file and exits with
+// status 1 if any count grew or a scenario has no budget, --write-budgets
+// stores the current counts.
+// Budget lines are "<scenario> <transactions> <address windows> <pixels>",
+// lines starting with # are comments.
+//
+// The scenarios tap the sketch's touch targets and run its tasks, see
+// ui_controller.cpp, so the counts are those of the real handlers.
+
+#include "sketch_host.h"
+
+struct ScenarioResult {
+  const char *name;
+  HostBusStats stats;
+};
+
+static const int MAX_SCENARIOS = 16;
+static ScenarioResult results[MAX_SCENARIOS];
+static int resultCount = 0;
+
+static void beginScenario() {
+  tft.resetStats();
+}
+
+static void endScenario(const char *name) {
+  if (resultCount < MAX_SCENARIOS) {
+    results[resultCount].name = name;
+    results[resultCount].stats = tft.getStats();
+    resultCount++;
+  }
+}
+
+static void runScenarios() {
+  // setup() draws the whole UI
+  beginScenario();
+  startSketch();
+  endScenario("boot_draw_ui");
+
+  // Tap on the cell above the path end
+  PathCell last = gridModel.getPathCell(gridModel.getPathLength() - 1);
+  beginScenario();
+  tapCell(last.row - 1, last.col);
+  runFor(20);
+  endScenario("grid_tap");
+
+  // Undo short press
+  beginScenario();
+  tapButton(undoButton);
+  runFor(20);
+  endScenario("undo");
+
+  // Redo of the undone cell
+  beginScenario();
+  tapButton(redoButton);
+  runFor(20);
+  endScenario("redo");
+
+  // Settings open and close
+  beginScenario();
+  tapButton(settingsButton);
+  runFor(20);
+  endScenario("settings_open");
+  beginScenario();
+  tapButton(settingsButton);
+  runFor(20);
+  endScenario("settings_close");
+
+  // Start pressed, then one countdown tick
+  beginScenario();
+  tapButton(startButton);
+  runFor(20);
+  endScenario("start_press");
+  beginScenario();
+  runFor(1000);
+  endScenario("countdown_tick");
+
+  // A whole run along a 60 cell serpentine path, from the start press to
+  // the finished run, after stopping the countdown above
+  tapButton(startButton);
+  setSerpentinePath(60);
+  runFor(20);
+  beginScenario();
+  tapButton(startButton);
+  while (uiState != COMPLETE) {
+    runFor(20);
+  }
+  runFor(20);
+  endScenario("run_60_cells");
+}
+
+static void printJson(double clockHz) {
+  printf("{\n  \"spi_clock_hz\": %.0f,\n  \"scenarios\": [\n", clockHz);
+  for (int i = 0; i < resultCount; i++) {
+    const HostBusStats &s = results[i].stats;
+    printf("    {\"name\": \"%s\", \"transactions\": %lu, \"address_windows\": %lu, "
+           "\"pixels\": %lu, \"bytes\": %lu, \"spi_us\": %.0f}%s\n",
+           results[i].name, s.transactions, s.addressWindows, s.pixels, s.bytes(),
+           s.spiMicros(clockHz), i + 1 < resultCount ? "," : "");
+  }
+  printf("  ]\n}\n");
+}
+
+static bool writeBudgets(const char *path) {
+  FILE *file = fopen(path, "w");
+  if (!file) {
+    return false;
+  }
+  fprintf(file, "# Bus traffic budgets for host/render_bench: scenario, transactions,\n"
+                "# address windows, pixels. Regenerate with --write-budgets after an\n"
+                "# intended rendering change.\n");
+  for (int i = 0; i < resultCount; i++) {
+    const HostBusStats &s = results[i].stats;
+    fprintf(file, "%s %lu %lu %lu\n", results[i].name, s.transactions, s.addressWindows, s.pixels);
+  }
+  return fclose(file) == 0;
+}
+
+// Returns the number of scenarios over budget or without one, or -1 if the
+// file cannot be read
+static int checkBudgets(const char *path) {
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    return -1;
+  }
+  int failures = 0;
+  bool budgeted[MAX_SCENARIOS] = { false };
+  char line[128];
+  while (fgets(line, sizeof(line), file)) {
+    char name[64];
+    unsigned long transactions, windows, pixels;
+    if (line[0] == '#' || sscanf(line, "%63s %lu %lu %lu", name, &transactions, &windows, &pixels) != 4) {
+      continue;  // Comment or blank line
+    }
+    for (int i = 0; i < resultCount; i++) {
+      if (strcmp(results[i].name, name) != 0) {
+        continue;
+      }
+      budgeted[i] = true;
+      const HostBusStats &s = results[i].stats;
+      if (s.transactions > transactions || s.addressWindows > windows || s.pixels > pixels) {
+        fprintf(stderr, "%s over budget: %lu/%lu transactions, %lu/%lu windows, %lu/%lu pixels\n",
+                name, s.transactions, transactions, s.addressWindows, windows, s.pixels, pixels);
+        failures++;
+      }
+    }
+  }
+  fclose(file);
+
+  // A new scenario needs a budget before it can catch regressions
+  for (int i = 0; i < resultCount; i++) {
+    if (!budgeted[i]) {
+      fprintf(stderr, "%s has no budget\n", results[i].name);
+      failures++;
+    }
+  }
+  return failures;
+}
+
+int main(int argc, char **argv) {
+  double clockHz = 24000000.0;
+  const char *checkPath = NULL;
+  const char *writePath = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--clock") == 0 && i + 1 < argc) {
+      clockHz = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--check") == 0 && i + 1 < argc) {
+      checkPath = argv[++i];
+    } else if (strcmp(argv[i], "--write-budgets") == 0 && i + 1 < argc) {
+      writePath = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--clock HZ] [--check BUDGETS] [--write-budgets BUDGETS]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  runScenarios();
+  printJson(clockHz);
+
+  if (writePath && !writeBudgets(writePath)) {
+    fprintf(stderr, "cannot write %s\n", writePath);
+    return 2;
+  }
+  if (checkPath) {
+    int failures = checkBudgets(checkPath);
+    if (failures < 0) {
+      fprintf(stderr, "cannot read %s\n", checkPath);
+      return 2;
+    }
+    return failures > 0 ? 1 : 0;
+  }
+  return 0;
+}
@@ -0,0 +1,162 @@
+// Golden-image test of the UI. Brings up the idle grid, the settings
+// overlay, the countdown and a run in progress by tapping the sketch's touch
+// targets and running its tasks on the host framebuffer, and compares each
+// screen byte for byte with a PPM in the golden directory. Undo followed by
+// redo, and closing the overlay, must also give back the idle screen.
+//
+//   render_golden_test GOLDEN_DIR [--update]
+//
+// Each rendered screen is also written to the working directory, so a failed
+// comparison can be inspected. --update stores the rendered screens as the
+// new golden images after an intended rendering change.
+
+#include "sketch_host.h"
+
+static const char *goldenDir = NULL;
+static bool update = false;
+static int failures = 0;
+
+// Copy of a screen, for checks against an earlier one
+static uint16_t saved[HostFramebuffer::WIDTH * HostFramebuffer::HEIGHT];
+
+static void saveScreen() {
+  for (int py = 0; py < HostFramebuffer::HEIGHT; py++) {
+    for (int px = 0; px < HostFramebuffer::WIDTH; px++) {
+      saved[py * HostFramebuffer::WIDTH + px] = tft.getPixel(px, py);
+    }
+  }
+}
+
+// Compare the screen with the saved one
+static void checkSameAsSaved(const char *name) {
+  for (int py = 0; py < HostFramebuffer::HEIGHT; py++) {
+    for (int px = 0; px < HostFramebuffer::WIDTH; px++) {
+      if (tft.getPixel(px, py) != saved[py * HostFramebuffer::WIDTH + px]) {
+        fprintf(stderr, "%s: differs from the saved screen at pixel (%d, %d)\n", name, px, py);
+        failures++;
+        return;
+      }
+    }
+  }
+  printf("%s: ok\n", name);
+}
+
+// Read a whole file, returns the number of bytes or -1
+static long readFile(const char *path, unsigned char *buffer, long capacity) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    return -1;
+  }
+  long size = (long)fread(buffer, 1, capacity, file);
+  fclose(file);
+  return size;
+}
+
+// Compare the screen with the golden image of the same name
+static void checkScreen(const char *name) {
+  static const long PPM_CAPACITY = 3L * HostFramebuffer::WIDTH * HostFramebuffer::HEIGHT + 64;
+  static unsigned char actual[PPM_CAPACITY];
+  static unsigned char expected[PPM_CAPACITY];
+
+  char actualPath[256];
+  char goldenPath[256];
+  snprintf(actualPath, sizeof(actualPath), "%s.ppm", name);
+  snprintf(goldenPath, sizeof(goldenPath), "%s/%s.ppm", goldenDir, name);
+
+  if (!tft.savePPM(update ? goldenPath : actualPath)) {
+    fprintf(stderr, "%s: cannot write %s\n", name, update ? goldenPath : actualPath);
+    failures++;
+    return;
+  }
+  if (update) {
+    printf("%s: updated\n", name);
+    return;
+  }
+
+  long actualSize = readFile(actualPath, actual, PPM_CAPACITY);
+  long expectedSize = readFile(goldenPath, expected, PPM_CAPACITY);
+  if (expectedSize < 0) {
+    fprintf(stderr, "%s: cannot read %s\n", name, goldenPath);
+    failures++;
+    return;
+  }
+  if (actualSize != expectedSize || memcmp(actual, expected, actualSize) != 0) {
+    // Report the first pixel that differs, counting from the end of the header
+    long offset = 0;
+    while (offset < actualSize && offset < expectedSize && actual[offset] == expected[offset]) {
+      offset++;
+    }
+    long pixel = (offset - (actualSize - 3L * HostFramebuffer::WIDTH * HostFramebuffer::HEIGHT)) / 3;
+    fprintf(stderr, "%s: differs from %s at pixel (%ld, %ld), see %s\n", name, goldenPath,
+            pixel % HostFramebuffer::WIDTH, pixel / HostFramebuffer::WIDTH, actualPath);
+    failures++;
+    return;
+  }
+  printf("%s: ok\n", name);
+}
+
+// The four screens, reached the way a user would
+static void renderScreens() {
+  startSketch();
+
+  // Idle grid after boot with a short path drawn
+  PathCell last = gridModel.getPathCell(gridModel.getPathLength() - 1);
+  tapCell(last.row - 1, last.col);
+  tapCell(last.row - 1, last.col + 1);
+  runFor(20);
+  checkScreen("idle");
+  saveScreen();
+
+  // Undo then redo must give back the idle screen exactly
+  tapButton(undoButton);
+  runFor(20);
+  tapButton(redoButton);
+  runFor(20);
+  checkSameAsSaved("undo_redo");
+
+  // Settings overlay
+  tapButton(settingsButton);
+  runFor(20);
+  checkScreen("settings");
+
+  // Closing the overlay must give back the idle screen exactly
+  tapButton(settingsButton);
+  runFor(20);
+  checkSameAsSaved("settings_closed");
+
+  // Start pressed, first countdown number shown
+  tapButton(startButton);
+  runFor(20);
+  checkScreen("countdown");
+
+  // A longer path part way through its run, started after stopping the
+  // countdown above
+  tapButton(startButton);
+  setSerpentinePath(20);
+  tapButton(startButton);
+  while (gridModel.getCurrentPathIndex() < 8) {
+    runFor(1);
+  }
+  runFor(20);
+  checkScreen("running");
+}
+
+int main(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--update") == 0) {
+      update = true;
+    } else if (!goldenDir) {
+      goldenDir = argv[i];
+    } else {
+      goldenDir = NULL;
+      break;
+    }
+  }
+  if (!goldenDir) {
+    fprintf(stderr, "usage: %s GOLDEN_DIR [--update]\n", argv[0]);
+    return 2;
+  }
+
+  renderScreens();
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,352 @@
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+// Host stand-in for the part of Adafruit_GFX the UI uses. The primitives and
+// the classic 5x7 text follow the library's own algorithms, including which
+// calls go through the overridable write* hooks, so a subclass sees the same
+// call pattern and draws the same pixels as on the robot. Being part of the
+// tree it also keeps host renders and golden images independent of the
+// installed library version.
+
+#include "Arduino.h"
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h)
+    : _width(w), _height(h), cursor_x(0), cursor_y(0), textcolor(0xFFFF), textbgcolor(0xFFFF),
+      textsize_x(1), textsize_y(1), wrap(true) {}
+  virtual ~Adafruit_GFX() {}
+
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  // Drawing hooks, a display overrides drawPixel and any it can do faster
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+  virtual void startWrite() {}
+  virtual void endWrite() {}
+  virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) { fillRect(x, y, w, h, color); }
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { drawFastVLine(x, y, h, color); }
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { drawFastHLine(x, y, w, color); }
+
+  // Bresenham line, one writePixel per point
+  virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+      swap(x0, y0);
+      swap(x1, y1);
+    }
+    if (x0 > x1) {
+      swap(x0, x1);
+      swap(y0, y1);
+    }
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = y0 < y1 ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+      if (steep) {
+        writePixel(y0, x0, color);
+      } else {
+        writePixel(x0, y0, color);
+      }
+      err -= dy;
+      if (err < 0) {
+        y0 += ystep;
+        err += dx;
+      }
+    }
+  }
+
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    startWrite();
+    writeLine(x, y, x, y + h - 1, color);
+    endWrite();
+  }
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    startWrite();
+    writeLine(x, y, x + w - 1, y, color);
+    endWrite();
+  }
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    for (int16_t i = x; i < x + w; i++) {
+      writeFastVLine(i, y, h, color);
+    }
+    endWrite();
+  }
+  virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (x0 == x1) {
+      drawFastVLine(x0, min(y0, y1), abs(y1 - y0) + 1, color);
+    } else if (y0 == y1) {
+      drawFastHLine(min(x0, x1), y0, abs(x1 - x0) + 1, color);
+    } else {
+      startWrite();
+      writeLine(x0, y0, x1, y1, color);
+      endWrite();
+    }
+  }
+
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    writeFastHLine(x, y, w, color);
+    writeFastHLine(x, y + h - 1, w, color);
+    writeFastVLine(x, y, h, color);
+    writeFastVLine(x + w - 1, y, h, color);
+    endWrite();
+  }
+
+  // Scanline fill between the edges of a triangle sorted by y
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    if (y0 > y1) {
+      swap(y0, y1);
+      swap(x0, x1);
+    }
+    if (y1 > y2) {
+      swap(y2, y1);
+      swap(x2, x1);
+    }
+    if (y0 > y1) {
+      swap(y0, y1);
+      swap(x0, x1);
+    }
+
+    startWrite();
+    if (y0 == y2) {
+      // All on one line
+      int16_t a = min(x0, min(x1, x2));
+      int16_t b = max(x0, max(x1, x2));
+      writeFastHLine(a, y0, b - a + 1, color);
+      endWrite();
+      return;
+    }
+
+    int16_t dx01 = x1 - x0, dy01 = y1 - y0;
+    int16_t dx02 = x2 - x0, dy02 = y2 - y0;
+    int16_t dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t sa = 0, sb = 0;
+
+    // Upper part, the y1 scanline belongs to it only for a flat bottom
+    int16_t last = y1 == y2 ? y1 : y1 - 1;
+    int16_t y;
+    for (y = y0; y <= last; y++) {
+      int16_t a = x0 + sa / dy01;
+      int16_t b = x0 + sb / dy02;
+      sa += dx01;
+      sb += dx02;
+      if (a > b) {
+        swap(a, b);
+      }
+      writeFastHLine(a, y, b - a + 1, color);
+    }
+
+    // Lower part
+    sa = (int32_t)dx12 * (y - y1);
+    sb = (int32_t)dx02 * (y - y0);
+    for (; y <= y2; y++) {
+      int16_t a = x1 + sa / dy12;
+      int16_t b = x0 + sb / dy02;
+      sa += dx12;
+      sb += dx02;
+      if (a > b) {
+        swap(a, b);
+      }
+      writeFastHLine(a, y, b - a + 1, color);
+    }
+    endWrite();
+  }
+
+  // Classic built-in font, 5x7 glyphs in a 6x8 cell. With a background
+  // colour equal to the text colour the background is left untouched.
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+    drawChar(x, y, c, color, bg, size, size);
+  }
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y) {
+    if (x >= _width || y >= _height || x + 6 * size_x - 1 < 0 || y + 8 * size_y - 1 < 0) {
+      return;
+    }
+    startWrite();
+    for (int8_t i = 0; i < 5; i++) {
+      uint8_t line = glyphColumn(c, i);
+      for (int8_t j = 0; j < 8; j++, line >>= 1) {
+        if (!(line & 1) && bg == color) {
+          continue;
+        }
+        uint16_t pixel = (line & 1) ? color : bg;
+        if (size_x == 1 && size_y == 1) {
+          writePixel(x + i, y + j, pixel);
+        } else {
+          writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, pixel);
+        }
+      }
+    }
+    if (bg != color) {
+      // Spacing column of an opaque character
+      if (size_x == 1 && size_y == 1) {
+        writeFastVLine(x + 5, y, 8, bg);
+      } else {
+        writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
+      }
+    }
+    endWrite();
+  }
+
+  void setCursor(int16_t x, int16_t y) {
+    cursor_x = x;
+    cursor_y = y;
+  }
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t bg) {
+    textcolor = c;
+    textbgcolor = bg;
+  }
+  void setTextSize(uint8_t s) { setTextSize(s, s); }
+  void setTextSize(uint8_t sx, uint8_t sy) {
+    textsize_x = sx > 0 ? sx : 1;
+    textsize_y = sy > 0 ? sy : 1;
+  }
+  void setTextWrap(bool w) { wrap = w; }
+
+  using Print::write;
+  size_t write(uint8_t c) override {
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += textsize_y * 8;
+    } else if (c != '\r') {
+      if (wrap && cursor_x + textsize_x * 6 > _width) {
+        cursor_x = 0;
+        cursor_y += textsize_y * 8;
+      }
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+      cursor_x += textsize_x * 6;
+    }
+    return 1;
+  }
+
+protected:
+  int16_t _width;
+  int16_t _height;
+  int16_t cursor_x;
+  int16_t cursor_y;
+  uint16_t textcolor;
+  uint16_t textbgcolor;
+  uint8_t textsize_x;
+  uint8_t textsize_y;
+  bool wrap;
+
+private:
+  static void swap(int16_t &a, int16_t &b) {
+    int16_t t = a;
+    a = b;
+    b = t;
+  }
+
+  // Column i of a printable ASCII glyph, bit 0 at the top. Other codes are blank.
+  static uint8_t glyphColumn(unsigned char c, int i) {
+    static const uint8_t font[] = {
+      0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+      0x00, 0x00, 0x5F, 0x00, 0x00,  // !
+      0x00, 0x07, 0x00, 0x07, 0x00,  // "
+      0x14, 0x7F, 0x14, 0x7F, 0x14,  // #
+      0x24, 0x2A, 0x7F, 0x2A, 0x12,  // $
+      0x23, 0x13, 0x08, 0x64, 0x62,  // %
+      0x36, 0x49, 0x56, 0x20, 0x50,  // &
+      0x00, 0x08, 0x07, 0x03, 0x00,  // '
+      0x00, 0x1C, 0x22, 0x41, 0x00,  // (
+      0x00, 0x41, 0x22, 0x1C, 0x00,  // )
+      0x2A, 0x1C, 0x7F, 0x1C, 0x2A,  // *
+      0x08, 0x08, 0x3E, 0x08, 0x08,  // +
+      0x00, 0x80, 0x70, 0x30, 0x00,  // ,
+      0x08, 0x08, 0x08, 0x08, 0x08,  // -
+      0x00, 0x00, 0x60, 0x60, 0x00,  // .
+      0x20, 0x10, 0x08, 0x04, 0x02,  // /
+      0x3E, 0x51, 0x49, 0x45, 0x3E,  // 0
+      0x00, 0x42, 0x7F, 0x40, 0x00,  // 1
+      0x72, 0x49, 0x49, 0x49, 0x46,  // 2
+      0x21, 0x41, 0x49, 0x4D, 0x33,  // 3
+      0x18, 0x14, 0x12, 0x7F, 0x10,  // 4
+      0x27, 0x45, 0x45, 0x45, 0x39,  // 5
+      0x3C, 0x4A, 0x49, 0x49, 0x31,  // 6
+      0x41, 0x21, 0x11, 0x09, 0x07,  // 7
+      0x36, 0x49, 0x49, 0x49, 0x36,  // 8
+      0x46, 0x49, 0x49, 0x29, 0x1E,  // 9
+      0x00, 0x00, 0x14, 0x00, 0x00,  // :
+      0x00, 0x40, 0x34, 0x00, 0x00,  // ;
+      0x00, 0x08, 0x14, 0x22, 0x41,  // <
+      0x14, 0x14, 0x14, 0x14, 0x14,  // =
+      0x00, 0x41, 0x22, 0x14, 0x08,  // >
+      0x02, 0x01, 0x59, 0x09, 0x06,  // ?
+      0x3E, 0x41, 0x5D, 0x59, 0x4E,  // @
+      0x7C, 0x12, 0x11, 0x12, 0x7C,  // A
+      0x7F, 0x49, 0x49, 0x49, 0x36,  // B
+      0x3E, 0x41, 0x41, 0x41, 0x22,  // C
+      0x7F, 0x41, 0x41, 0x41, 0x3E,  // D
+      0x7F, 0x49, 0x49, 0x49, 0x41,  // E
+      0x7F, 0x09, 0x09, 0x09, 0x01,  // F
+      0x3E, 0x41, 0x41, 0x51, 0x73,  // G
+      0x7F, 0x08, 0x08, 0x08, 0x7F,  // H
+      0x00, 0x41, 0x7F, 0x41, 0x00,  // I
+      0x20, 0x40, 0x41, 0x3F, 0x01,  // J
+      0x7F, 0x08, 0x14, 0x22, 0x41,  // K
+      0x7F, 0x40, 0x40, 0x40, 0x40,  // L
+      0x7F, 0x02, 0x1C, 0x02, 0x7F,  // M
+      0x7F, 0x04, 0x08, 0x10, 0x7F,  // N
+      0x3E, 0x41, 0x41, 0x41, 0x3E,  // O
+      0x7F, 0x09, 0x09, 0x09, 0x06,  // P
+      0x3E, 0x41, 0x51, 0x21, 0x5E,  // Q
+      0x7F, 0x09, 0x19, 0x29, 0x46,  // R
+      0x26, 0x49, 0x49, 0x49, 0x32,  // S
+      0x03, 0x01, 0x7F, 0x01, 0x03,  // T
+      0x3F, 0x40, 0x40, 0x40, 0x3F,  // U
+      0x1F, 0x20, 0x40, 0x20, 0x1F,  // V
+      0x3F, 0x40, 0x38, 0x40, 0x3F,  // W
+      0x63, 0x14, 0x08, 0x14, 0x63,  // X
+      0x03, 0x04, 0x78, 0x04, 0x03,  // Y
+      0x61, 0x59, 0x49, 0x4D, 0x43,  // Z
+      0x00, 0x7F, 0x41, 0x41, 0x41,  // [
+      0x02, 0x04, 0x08, 0x10, 0x20,  // backslash
+      0x00, 0x41, 0x41, 0x41, 0x7F,  // ]
+      0x04, 0x02, 0x01, 0x02, 0x04,  // ^
+      0x40, 0x40, 0x40, 0x40, 0x40,  // _
+      0x00, 0x03, 0x07, 0x08, 0x00,  // `
+      0x20, 0x54, 0x54, 0x78, 0x40,  // a
+      0x7F, 0x28, 0x44, 0x44, 0x38,  // b
+      0x38, 0x44, 0x44, 0x44, 0x28,  // c
+      0x38, 0x44, 0x44, 0x28, 0x7F,  // d
+      0x38, 0x54, 0x54, 0x54, 0x18,  // e
+      0x00, 0x08, 0x7E, 0x09, 0x02,  // f
+      0x18, 0xA4, 0xA4, 0x9C, 0x78,  // g
+      0x7F, 0x08, 0x04, 0x04, 0x78,  // h
+      0x00, 0x44, 0x7D, 0x40, 0x00,  // i
+      0x20, 0x40, 0x40, 0x3D, 0x00,  // j
+      0x7F, 0x10, 0x28, 0x44, 0x00,  // k
+      0x00, 0x41, 0x7F, 0x40, 0x00,  // l
+      0x7C, 0x04, 0x78, 0x04, 0x78,  // m
+      0x7C, 0x08, 0x04, 0x04, 0x78,  // n
+      0x38, 0x44, 0x44, 0x44, 0x38,  // o
+      0xFC, 0x18, 0x24, 0x24, 0x18,  // p
+      0x18, 0x24, 0x24, 0x18, 0xFC,  // q
+      0x7C, 0x08, 0x04, 0x04, 0x08,  // r
+      0x48, 0x54, 0x54, 0x54, 0x24,  // s
+      0x04, 0x04, 0x3F, 0x44, 0x24,  // t
+      0x3C, 0x40, 0x40, 0x20, 0x7C,  // u
+      0x1C, 0x20, 0x40, 0x20, 0x1C,  // v
+      0x3C, 0x40, 0x30, 0x40, 0x3C,  // w
+      0x44, 0x28, 0x10, 0x28, 0x44,  // x
+      0x4C, 0x90, 0x90, 0x90, 0x7C,  // y
+      0x44, 0x64, 0x54, 0x4C, 0x44,  // z
+      0x00, 0x08, 0x36, 0x41, 0x00,  // {
+      0x00, 0x00, 0x77, 0x00, 0x00,  // |
+      0x00, 0x41, 0x36, 0x08, 0x00,  // }
+      0x02, 0x01, 0x02, 0x04, 0x02,  // ~
+    };
+    if (c < 0x20 || c > 0x7E) {
+      return 0;
+    }
+    return font[(c - 0x20) * 5 + i];
+  }
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Minimal Arduino core for compiling the sketch sources on a host. Only what
+// the model, UI and Adafruit_GFX use is provided.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARDUINO 100
+
+#define PROGMEM
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_pointer(addr) ((void *)*(void *const *)(addr))
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+// Host only. Stops the clock at its current time; from then on time passes
+// only in delay() and yield(), one millisecond per yield. Programs that
+// replay the sketch's tasks use it so their results do not depend on the
+// speed of the host and long runs take no real time.
+void hostFreezeClock();
+
+#include "WString.h"
+#include "Print.h"
+
+// Serial writes to standard error, standard output is left to the program
+class HostSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) override { return fputc(c, stderr) == EOF ? 0 : 1; }
+};
+extern HostSerial Serial;
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef HOST_PRINT_H
+#define HOST_PRINT_H
+
+// Text output with the Arduino Print interface, formatted with snprintf
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size-- > 0) {
+      n += write(*buffer++);
+    }
+    return n;
+  }
+  size_t write(const char *str) { return write((const uint8_t *)str, strlen(str)); }
+
+  size_t print(const char *s) { return write(s); }
+  size_t print(const __FlashStringHelper *s) { return write((const char *)s); }
+  size_t print(const String &s) { return write(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int n, int base = 10) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = 10) { return print((unsigned long)n, base); }
+  size_t print(long n, int base = 10) { return base == 10 ? format("%ld", n) : print((unsigned long)n, base); }
+  size_t print(unsigned long n, int base = 10) { return format(base == 16 ? "%lx" : "%lu", n); }
+  size_t print(double n, int digits = 2) { return format("%.*f", digits, n); }
+
+  template <typename T>
+  size_t println(T value) { return print(value) + println(); }
+  template <typename T>
+  size_t println(T value, int base) { return print(value, base) + println(); }
+  size_t println() { return write("\r\n"); }
+
+private:
+  template <typename T>
+  size_t format(const char *spec, T value) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), spec, value);
+    return write(buffer);
+  }
+  size_t format(const char *spec, int digits, double value) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), spec, digits, value);
+    return write(buffer);
+  }
+};
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef HOST_TOUCHSCREEN_H
+#define HOST_TOUCHSCREEN_H
+
+// Stand-in for the Adafruit TouchScreen library, so the touch headers
+// compile on a host. The panel is never touched; host programs deliver
+// touch events to the handlers directly.
+
+#include "Arduino.h"
+
+class TSPoint {
+public:
+  TSPoint() : x(0), y(0), z(0) {}
+  int16_t x, y, z;
+};
+
+class TouchScreen {
+public:
+  TouchScreen(uint8_t, uint8_t, uint8_t, uint8_t, uint16_t) : pressureThreshhold(10) {}
+  TSPoint getPoint() { return TSPoint(); }
+
+  int16_t pressureThreshhold;
+};
+
+#endif
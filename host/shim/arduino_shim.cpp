@@ -0,0 +1,51 @@
+#include "Arduino.h"
+#include <time.h>
+
+HostSerial Serial;
+
+// Time since the first call, like time since boot
+static uint64_t elapsedMicros() {
+  static struct timespec start;
+  static bool started = false;
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  if (!started) {
+    start = now;
+    started = true;
+  }
+  return (uint64_t)(now.tv_sec - start.tv_sec) * 1000000 + (now.tv_nsec - start.tv_nsec) / 1000;
+}
+
+// Frozen time, only advanced by delay() and yield() once frozen
+static bool frozen = false;
+static uint64_t frozenMicros = 0;
+
+unsigned long millis() {
+  return (frozen ? frozenMicros : elapsedMicros()) / 1000;
+}
+
+unsigned long micros() {
+  return frozen ? frozenMicros : elapsedMicros();
+}
+
+void delay(unsigned long ms) {
+  if (frozen) {
+    frozenMicros += (uint64_t)ms * 1000;
+    return;
+  }
+  struct timespec wait;
+  wait.tv_sec = ms / 1000;
+  wait.tv_nsec = (ms % 1000) * 1000000L;
+  nanosleep(&wait, NULL);
+}
+
+void yield() {
+  if (frozen) {
+    frozenMicros += 1000;
+  }
+}
+
+void hostFreezeClock() {
+  frozenMicros = elapsedMicros();
+  frozen = true;
+}
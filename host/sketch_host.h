@@ -0,0 +1,62 @@
+#ifndef HOST_SKETCH_HOST_H
+#define HOST_SKETCH_HOST_H
+
+// Host side of grid_bot.ino, for programs that replay the sketch. Provides
+// the display and backlight that ui_controller.cpp expects, starts the
+// sketch the way setup() does and delivers touches the way the touch task
+// does, so scenarios run the real layout, handlers and tasks. Include it
+// from one source file per program.
+
+#include "ui_controller.h"
+
+HostFramebuffer tft;
+
+// No backlight on the host
+void setBrightness() {}
+
+// Same steps as setup() once the display is running. The clock is frozen
+// so task timing and flush slices do not depend on the speed of the host.
+void startSketch() {
+  hostFreezeClock();
+  initGridModel();
+  initUI();
+  drawUI();
+  addUITasks();
+}
+
+// Run the scheduler, as loop() does, for the given time
+void runFor(unsigned long ms) {
+  unsigned long end = millis() + ms;
+  while ((long)(millis() - end) <= 0) {
+    scheduler.run();
+  }
+}
+
+// A tap at a screen point, as the events the touch task delivers for it
+void tapAt(int px, int py) {
+  handleTouch(TOUCH_PRESS, px, py);
+  handleTouch(TOUCH_TAP, px, py);
+  handleTouch(TOUCH_RELEASE, px, py);
+}
+
+void tapButton(const UIButton &button) {
+  tapAt(button.x + button.width / 2, button.y + button.height / 2);
+}
+
+void tapCell(int row, int col) {
+  tapAt(uiGrid.x + col * CELL_SIZE + CELL_SIZE / 2, uiGrid.y + row * CELL_SIZE + CELL_SIZE / 2);
+}
+
+// Serpentine path of the given length up from the bottom row
+void setSerpentinePath(int length) {
+  PackedPath path;
+  for (int i = 0; path.length() < length; i++) {
+    int row = gridModel.getNumRows() - 1 - i / gridModel.getNumCols();
+    int offset = i % gridModel.getNumCols();
+    int col = (i / gridModel.getNumCols()) % 2 == 0 ? offset : gridModel.getNumCols() - 1 - offset;
+    path.push(row, col);
+  }
+  gridModel.setPath(path);
+}
+
+#endif
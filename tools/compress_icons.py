@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Convert RGB565 icons to the run-length encoded format used by grid_bot.
+
+Input is either a C source holding `const uint16_t NAME[] PROGMEM = {...};`
+arrays (the output of common RGB565 image converters) or PNG files, which
+need Pillow. Every icon is encoded in each supported format and the
+smallest is written as a `const uint8_t NAME[] PROGMEM` array on stdout.
+
+Encoded layout, see icons.h:
+  width, height, format, palette size
+  palette entries, little-endian RGB565
+  runs until width * height pixels are covered:
+    ICON_RLE565  count, colour low byte, colour high byte
+    ICON_PAL8    count, palette index
+    ICON_PAL4    (count - 1) << 4 | palette index
+
+Usage:
+  compress_icons.py icon_sources.c [--size 24x24]
+  compress_icons.py undo.png settings.png
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ICON_RLE565 = 0
+ICON_PAL8 = 1
+ICON_PAL4 = 2
+
+
+def runs_of(pixels, max_run):
+    """Split pixels into (value, count) runs no longer than max_run."""
+    runs = []
+    for value in pixels:
+        if runs and runs[-1][0] == value and runs[-1][1] < max_run:
+            runs[-1][1] += 1
+        else:
+            runs.append([value, 1])
+    return runs
+
+
+def encode(width, height, pixels):
+    """Return (format, bytes) for the smallest encoding of an icon."""
+    candidates = []
+
+    # Plain colour runs
+    data = [width, height, ICON_RLE565, 0]
+    for color, count in runs_of(pixels, 255):
+        data += [count, color & 0xFF, color >> 8]
+    candidates.append((ICON_RLE565, data))
+
+    # Palette runs, only when the palette fits its index width
+    palette = sorted(set(pixels))
+    lookup = {color: i for i, color in enumerate(palette)}
+    header = []
+    for color in palette:
+        header += [color & 0xFF, color >> 8]
+    if len(palette) <= 16:
+        data = [width, height, ICON_PAL4, len(palette)] + header
+        for color, count in runs_of(pixels, 16):
+            data.append(((count - 1) << 4) | lookup[color])
+        candidates.append((ICON_PAL4, data))
+    if len(palette) <= 255:
+        data = [width, height, ICON_PAL8, len(palette)] + header
+        for color, count in runs_of(pixels, 255):
+            data += [count, lookup[color]]
+        candidates.append((ICON_PAL8, data))
+
+    return min(candidates, key=lambda c: len(c[1]))
+
+
+def read_c_source(path, width, height):
+    """Yield (name, width, height, pixels) for every uint16_t array in a C file."""
+    text = open(path).read()
+    pattern = re.compile(r'const\s+uint16_t\s+(\w+)\[\]\s*(?:PROGMEM)?\s*=\s*\{(.*?)\};', re.S)
+    for match in pattern.finditer(text):
+        body = re.sub(r'//.*', '', match.group(2))
+        pixels = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', body)]
+        if len(pixels) != width * height:
+            sys.exit('%s: %d pixels, expected %dx%d' % (match.group(1), len(pixels), width, height))
+        yield match.group(1), width, height, pixels
+
+
+def read_png(path):
+    """Return (name, width, height, pixels) for a PNG converted to RGB565."""
+    from PIL import Image
+    image = Image.open(path).convert('RGB')
+    pixels = [((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3) for r, g, b in image.getdata()]
+    name = re.sub(r'\W', '_', os.path.splitext(os.path.basename(path))[0]).upper() + '_ICON'
+    return name, image.width, image.height, pixels
+
+
+def format_array(name, width, height, pixels):
+    fmt, data = encode(width, height, pixels)
+    label = {ICON_RLE565: 'RGB565 runs', ICON_PAL8: '8-bit palette runs',
+             ICON_PAL4: '4-bit palette runs'}[fmt]
+    lines = ['// %dx%d, %s, %d bytes (raw %d bytes)' % (width, height, label, len(data), width * height * 2),
+             'const uint8_t %s[] PROGMEM = {' % name]
+    for i in range(0, len(data), 16):
+        lines.append('  ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('inputs', nargs='+', help='C source or PNG files')
+    parser.add_argument('--size', default='24x24', help='icon size for C source input')
+    args = parser.parse_args()
+    width, height = (int(v) for v in args.size.lower().split('x'))
+
+    icons = []
+    for path in args.inputs:
+        if path.lower().endswith('.png'):
+            icons.append(read_png(path))
+        else:
+            icons.extend(read_c_source(path, width, height))
+
+    print('\n\n'.join(format_array(*icon) for icon in icons))
+
+
+if __name__ == '__main__':
+    main()
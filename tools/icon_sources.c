@@ -0,0 +1,167 @@
+// RGB565 source pixels for the grid_bot button icons.
+// Compress with: tools/compress_icons.py tools/icon_sources.c
+
+#include <stdint.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+const uint16_t UNDO_ICON[] PROGMEM = {
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xB596, 0xCE79, 0xE71C, 0xF7BE, 0xF7BE, 0xE71C, 0xCE59, 0xAD75,  // 0x0010 (16) pixels
+  0x8C51, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xDEDB, 0xE73C, 0x8C71, 0x7BCF, 0x7BCF, 0x7BEF, 0xC638, 0xFFDF,  // 0x0020 (32) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0030 (48) pixels
+  0xFFFF, 0xFFFF, 0xF79E, 0x8C71, 0x9CF3, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0040 (64) pixels
+  0xFFFF, 0xFFFF, 0xEF5D, 0x9CF3, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0050 (80) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0060 (96) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xCE59, 0xAD75, 0x8C71, 0x8C71, 0xB596, 0xCE79, 0xF79E,  // 0x0070 (112) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x7BCF, 0x7BCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A,  // 0x0080 (128) pixels
+  0x8430, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8430, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x7BEF, 0x7BCF,  // 0x0090 (144) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x00A0 (160) pixels
+  0x7BCF, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x7BCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D,  // 0x00B0 (176) pixels
+  0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71,  // 0x00C0 (192) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x00D0 (208) pixels
+  0x7BCF, 0x7BCF, 0x8430, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x00E0 (224) pixels
+  0xDEDB, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59,  // 0x00F0 (240) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0100 (256) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0110 (272) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE,  // 0x0120 (288) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0130 (304) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0140 (320) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C,  // 0x0150 (336) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0160 (352) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0170 (368) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8430, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596,  // 0x0180 (384) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x9CF3, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0190 (400) pixels
+  0x7BCF, 0x7BCF, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0xE71C, 0xFFFF, 0xC638, 0x7BCF,  // 0x01A0 (416) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x7BCF,  // 0x01B0 (432) pixels
+  0x7BCF, 0x7BCF, 0x7BEF, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x8410, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8430,  // 0x01C0 (448) pixels
+  0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0xA514, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x01D0 (464) pixels
+  0xF79E, 0xD6BA, 0xBDD7, 0x9492, 0x8C71, 0xB596, 0xCE79, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x7BCF, 0x7BCF,  // 0x01E0 (480) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x01F0 (496) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB5B6, 0xFFDF, 0xFFFF, 0xFFFF,  // 0x0200 (512) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x9CF3, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0210 (528) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0220 (544) pixels
+  0xFFFF, 0xC638, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71,  // 0x0230 (560) pixels
+  0xC618, 0xE73C, 0xF79E, 0xFFDF, 0xF7BE, 0xE71C, 0xCE59, 0xAD75, 0x8C51, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0240 (576) pixels
+};
+
+
+const uint16_t REDO_ICON[] PROGMEM = {
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C51, 0xAD75, 0xCE59, 0xE71C, 0xF7BE, 0xF7BE, 0xE71C, 0xCE79, 0xB596,  // 0x0010 (16) pixels
+  0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0xC638, 0xFFFF,  // 0x0020 (32) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xC638, 0x7BEF, 0x7BCF, 0x7BCF, 0x8C71, 0xE73C, 0xDEDB,  // 0x0030 (48) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x9CF3, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0040 (64) pixels
+  0xFFFF, 0xFFFF, 0xEF7D, 0x9CF3, 0x8C71, 0xF79E, 0xFFFF, 0xFFFF, 0x7BCF, 0x7BCF, 0x7BCF, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0050 (80) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0060 (96) pixels
+  0x7BCF, 0x7BCF, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xCE79, 0xB596, 0x8C71, 0x8C71, 0xAD75, 0xCE59, 0xF7BE,  // 0x0070 (112) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BCF, 0x7BEF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A,  // 0x0080 (128) pixels
+  0x8430, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8430, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0090 (144) pixels
+  0x7BCF, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x00A0 (160) pixels
+  0x8C71, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x7BCF, 0x7BCF,  // 0x00B0 (176) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x00C0 (192) pixels
+  0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x8430, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xE73C,  // 0x00D0 (208) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x00E0 (224) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C,  // 0x00F0 (240) pixels
+  0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0100 (256) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0110 (272) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0120 (288) pixels
+  0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0130 (304) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0140 (320) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0150 (336) pixels
+  0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0160 (352) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x8430, 0x7BCF, 0x7BCF,  // 0x0170 (368) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0180 (384) pixels
+  0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0190 (400) pixels
+  0x7BCF, 0x7BCF, 0x9CF3, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x7BCF,  // 0x01A0 (416) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xC638, 0xFFFF, 0xE71C, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x01B0 (432) pixels
+  0x7BCF, 0x7BEF, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x8430, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8410,  // 0x01C0 (448) pixels
+  0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x01D0 (464) pixels
+  0xF79E, 0xCE79, 0xB596, 0x8C71, 0x9492, 0xBDD7, 0xD6BA, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA514, 0x7BCF, 0x7BCF,  // 0x01E0 (480) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x01F0 (496) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDD7, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x9CF3, 0xEF5D, 0xFFFF, 0xFFFF,  // 0x0200 (512) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xB5B6, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0210 (528) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0xC638, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0220 (544) pixels
+  0xFFFF, 0xDEDB, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C51,  // 0x0230 (560) pixels
+  0xAD75, 0xCE59, 0xE71C, 0xF7BE, 0xFFDF, 0xF79E, 0xE73C, 0xC618, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0240 (576) pixels
+};
+
+
+const uint16_t SETTINGS_ICON[] PROGMEM = {
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x9CD3, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9CD3,  // 0x0010 (16) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0020 (32) pixels
+  0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0030 (48) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA,  // 0x0040 (64) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8410, 0xC618, 0xAD75, 0x7BEF, 0x7BCF, 0x8410,  // 0x0050 (80) pixels
+  0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x8410, 0x7BCF, 0x7BEF, 0xAD75, 0xC618, 0x7BEF, 0x7BCF, 0x7BCF,  // 0x0060 (96) pixels
+  0x7BCF, 0x7BCF, 0xD69A, 0xFFFF, 0xFFFF, 0xF7BE, 0xCE79, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0070 (112) pixels
+  0xF79E, 0xCE79, 0xF7BE, 0xFFFF, 0xFFFF, 0xCE79, 0x7BCF, 0x7BCF, 0x7BCF, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0080 (128) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0x7BCF,  // 0x0090 (144) pixels
+  0x7BCF, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x00A0 (160) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x7BCF, 0xAD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x00B0 (176) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD55,  // 0x00C0 (192) pixels
+  0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xBDD7, 0x8C71, 0x8C71, 0xB5B6, 0xF7BE, 0xFFFF,  // 0x00D0 (208) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x9CF3, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x00E0 (224) pixels
+  0xF7BE, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C51, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9CF3,  // 0x00F0 (240) pixels
+  0x7BCF, 0x8C71, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDD7, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB5B6,  // 0x0100 (256) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0110 (272) pixels
+  0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x7BCF, 0x7BCF,  // 0x0120 (288) pixels
+  0x7BCF, 0x7BCF, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71,  // 0x0130 (304) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C71, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0140 (320) pixels
+  0xBDD7, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x8C71, 0x7BCF,  // 0x0150 (336) pixels
+  0x9CF3, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x8C71, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C51, 0xF7BE,  // 0x0160 (352) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9CF3, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0170 (368) pixels
+  0xFFFF, 0xF7BE, 0xBDD7, 0x8C71, 0x8C71, 0xB5B6, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA,  // 0x0180 (384) pixels
+  0xAD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0190 (400) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75, 0x7BCF, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x01A0 (416) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x7BCF,  // 0x01B0 (432) pixels
+  0x7BCF, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x01C0 (448) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0x7BCF, 0x7BCF, 0x7BCF, 0xCE79, 0xFFFF, 0xFFFF, 0xF7BE, 0xCE79, 0xF79E,  // 0x01D0 (464) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xCE79, 0xF7BE, 0xFFFF, 0xFFFF, 0xD69A, 0x7BCF, 0x7BCF,  // 0x01E0 (480) pixels
+  0x7BCF, 0x7BCF, 0x7BEF, 0xC618, 0xB596, 0x7BEF, 0x7BCF, 0x8410, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D,  // 0x01F0 (496) pixels
+  0x8410, 0x7BCF, 0x7BEF, 0xAD75, 0xBDF7, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0200 (512) pixels
+  0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0210 (528) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638,  // 0x0220 (544) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0230 (560) pixels
+  0x94B2, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9CD3, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0240 (576) pixels
+};
+
+
+const uint16_t OPTIMIZE_ICON[] PROGMEM = {
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0010 (16) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0020 (32) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xAD55, 0xFFFF, 0xE73C, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0030 (48) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8C51, 0xF7BE, 0xFFFF, 0xB596,  // 0x0040 (64) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0050 (80) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xE73C, 0xFFFF, 0xFFFF, 0x8C51, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0060 (96) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xBDD7, 0xFFFF, 0xFFFF, 0xE73C, 0x7BCF,  // 0x0070 (112) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0080 (128) pixels
+  0x7BCF, 0x7BCF, 0x9CD3, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD55, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0090 (144) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8410, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0x8410, 0x7BCF,  // 0x00A0 (160) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x00B0 (176) pixels
+  0x7BCF, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x00C0 (192) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD55, 0x7BCF, 0x7BCF,  // 0x00D0 (208) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x9492,  // 0x00E0 (224) pixels
+  0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xB596, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x00F0 (240) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0100 (256) pixels
+  0xFFFF, 0xFFFF, 0x9CD3, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xC638, 0xFFFF,  // 0x0110 (272) pixels
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDD7, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0120 (288) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x9CD3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  // 0x0130 (304) pixels
+  0xDEFB, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xB596, 0xBDD7, 0xBDD7,  // 0x0140 (320) pixels
+  0xBDD7, 0xBDD7, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x8C51, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0150 (336) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x9CD3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA514,  // 0x0160 (352) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0170 (368) pixels
+  0x7BCF, 0x7BCF, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0180 (384) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xCE79, 0xFFFF, 0xFFFF, 0xE73C, 0x7BCF, 0x7BCF,  // 0x0190 (400) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x01A0 (416) pixels
+  0x7BCF, 0x7BCF, 0xE73C, 0xFFFF, 0xF7BE, 0x8C51, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x01B0 (432) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x8410, 0xFFFF, 0xFFFF, 0xA514, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x01C0 (448) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x01D0 (464) pixels
+  0x7BCF, 0x9CD3, 0xFFFF, 0xC638, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x01E0 (480) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0xBDD7, 0xE73C, 0x8410, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x01F0 (496) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0200 (512) pixels
+  0x7BCF, 0xCE79, 0x9492, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0210 (528) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x9CD3, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0220 (544) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0230 (560) pixels
+  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,  // 0x0240 (576) pixels
+};